@@ -0,0 +1,107 @@
+// MIT License
+//
+// Copyright (c) 2025 Ferhat Geçdoğan All Rights Reserved.
+// Distributed under the terms of the MIT License.
+//
+// measures ms per 1080p frame of Bloom::blur() and Bloom::apply() across radii.
+#include <bloom.hpp>
+#include <sampler_cache.hpp>
+#include <GLFW/glfw3.h>
+#include <glad/glad.h> // load after GLFW
+#include <array>
+#include <chrono>
+#include <cstdio>
+
+using namespace fre2d;
+
+constexpr GLsizei Width { 1920 };
+constexpr GLsizei Height { 1080 };
+constexpr int WarmupIterations { 10 };
+constexpr int Iterations { 200 };
+
+struct Timing {
+  double gpu_ms;
+  double cpu_ms;
+};
+
+template<typename Callable>
+Timing measure(Callable&& fn) {
+  for(int i = 0; i < WarmupIterations; ++i) {
+    fn();
+  }
+  glFinish();
+
+  GLuint query { 0 };
+  glGenQueries(1, &query);
+  const auto cpu_start = std::chrono::steady_clock::now();
+  glBeginQuery(GL_TIME_ELAPSED, query);
+  for(int i = 0; i < Iterations; ++i) {
+    fn();
+  }
+  glEndQuery(GL_TIME_ELAPSED);
+  glFinish();
+  const auto cpu_end = std::chrono::steady_clock::now();
+
+  GLuint64 elapsed_ns { 0 };
+  glGetQueryObjectui64v(query, GL_QUERY_RESULT, &elapsed_ns);
+  glDeleteQueries(1, &query);
+  return Timing {
+    static_cast<double>(elapsed_ns) / 1e6 / Iterations,
+    std::chrono::duration<double, std::milli>(cpu_end - cpu_start).count() / Iterations
+  };
+}
+
+int main() {
+  glfwInit();
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 5);
+  glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+  glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+
+  GLFWwindow* window = glfwCreateWindow(64, 64, "fre2d bloom benchmark", NULL, NULL);
+  if(window == NULL) {
+    std::puts("error: failed to create window");
+    glfwTerminate();
+    return -1;
+  }
+  glfwMakeContextCurrent(window);
+  if(!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+    std::puts("error: failed to initialize GLAD");
+    glfwTerminate();
+    return -1;
+  }
+  glfwSwapInterval(0);
+
+  {
+    const RenderTargetDesc hdr_desc { { ColorRgba16f }, DepthStencilNone };
+    Framebuffer input(Width, Height, hdr_desc);
+    Framebuffer output(Width, Height, hdr_desc);
+    input.call([&] {
+      input.clear_color(1.f, 0.9f, 0.5f, 1.f);
+    });
+
+    RenderTargetPool pool;
+    Bloom bloom(pool);
+
+    std::printf("%dx%d, %d iterations\n", Width, Height, Iterations);
+    std::printf("%8s %7s %14s %14s %14s %14s\n", "radius", "levels", "blur gpu ms", "blur cpu ms", "bloom gpu ms", "bloom cpu ms");
+    for(const GLfloat radius: std::array { 2.f, 4.f, 8.f, 16.f, 32.f, 64.f, 128.f, 256.f }) {
+      bloom.set_radius(radius);
+      const auto blur = measure([&] { bloom.blur(input, &output); });
+      const auto full = measure([&] { bloom.apply(input, &output); });
+      std::printf("%8.0f %7zu %14.3f %14.3f %14.3f %14.3f\n",
+                  radius, bloom.get_level_count(),
+                  blur.gpu_ms, blur.cpu_ms, full.gpu_ms, full.cpu_ms);
+    }
+    std::printf("pooled targets: %zu, %.2f MiB\n",
+                pool.get_target_count(),
+                static_cast<double>(pool.get_memory_usage()) / (1024.0 * 1024.0));
+  }
+  // no frame loop here, so targets and programs above were deleted as they
+  // were released; samplers and anything still registered are left.
+  SamplerCache::get().clear();
+  ResourceRegistry::get().clear();
+
+  glfwTerminate();
+  return 0;
+}
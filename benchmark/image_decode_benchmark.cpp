@@ -0,0 +1,139 @@
+// MIT License
+//
+// Copyright (c) 2025 Ferhat Geçdoğan All Rights Reserved.
+// Distributed under the terms of the MIT License.
+//
+// compares decode (and encode) time of PNG through stb_image and QOI through
+// fre2d for sprite sheets; cpu only. pass image files to measure them,
+// otherwise a generated 2048x2048 sheet (flat shapes, gradients and
+// transparent gaps like typical sprites) is used.
+//
+// usage: image_decode_benchmark [image]...
+#include <qoi.hpp>
+#include <stb_image.h>
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include <stb_image_write.h>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace fre2d;
+
+constexpr int Iterations { 20 };
+constexpr std::uint32_t SheetSize { 2048 };
+constexpr std::uint32_t SpriteSize { 64 };
+
+struct Image {
+  std::string name;
+  std::uint32_t width;
+  std::uint32_t height;
+  std::vector<std::uint8_t> rgba;
+};
+
+template<typename Callable>
+double measure_ms(Callable&& fn) {
+  fn(); // warmup
+  const auto start = std::chrono::steady_clock::now();
+  for(int i = 0; i < Iterations; ++i) {
+    fn();
+  }
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / Iterations;
+}
+
+Image generate_sprite_sheet() {
+  Image image { "generated 2048x2048 sheet", SheetSize, SheetSize, std::vector<std::uint8_t>(SheetSize * SheetSize * 4) };
+  for(std::uint32_t y = 0; y < SheetSize; ++y) {
+    for(std::uint32_t x = 0; x < SheetSize; ++x) {
+      auto* pixel = &image.rgba[(static_cast<std::size_t>(y) * SheetSize + x) * 4];
+      const std::uint32_t sprite { (y / SpriteSize) * (SheetSize / SpriteSize) + x / SpriteSize };
+      const int local_x { static_cast<int>(x % SpriteSize) - 32 }, local_y { static_cast<int>(y % SpriteSize) - 32 };
+      const bool inside { local_x * local_x + local_y * local_y < 28 * 28 };
+      if(!inside) {
+        pixel[0] = pixel[1] = pixel[2] = pixel[3] = 0;
+        continue;
+      }
+      switch(sprite % 3) {
+      case 0: { // flat palette colors.
+        pixel[0] = static_cast<std::uint8_t>(sprite * 37);
+        pixel[1] = static_cast<std::uint8_t>(sprite * 91);
+        pixel[2] = static_cast<std::uint8_t>(sprite * 53);
+        break;
+      }
+      case 1: { // shaded gradient.
+        pixel[0] = static_cast<std::uint8_t>(128 + local_x * 3);
+        pixel[1] = static_cast<std::uint8_t>(128 + local_y * 3);
+        pixel[2] = static_cast<std::uint8_t>(sprite);
+        break;
+      }
+      default: { // dithered texture.
+        const auto noise = static_cast<std::uint8_t>((x * 2654435761u ^ y * 40503u) >> 24);
+        pixel[0] = static_cast<std::uint8_t>(80 + (noise & 31));
+        pixel[1] = static_cast<std::uint8_t>(60 + (noise & 15));
+        pixel[2] = 40;
+        break;
+      }
+      }
+      pixel[3] = 255;
+    }
+  }
+  return image;
+}
+
+int main(int argc, char** argv) {
+  std::vector<Image> images;
+  for(int i = 1; i < argc; ++i) {
+    int width { 0 }, height { 0 }, channels { 0 };
+    auto* pixels = stbi_load(argv[i], &width, &height, &channels, 4);
+    if(!pixels) {
+      std::printf("cannot load %s\n", argv[i]);
+      continue;
+    }
+    images.push_back(Image {
+      argv[i],
+      static_cast<std::uint32_t>(width),
+      static_cast<std::uint32_t>(height),
+      std::vector<std::uint8_t>(pixels, pixels + static_cast<std::size_t>(width) * height * 4)
+    });
+    stbi_image_free(pixels);
+  }
+  if(images.empty()) {
+    images.push_back(generate_sprite_sheet());
+  }
+
+  std::printf("%-32s %10s %10s %12s %12s %12s %12s %8s\n", "image", "png KiB", "qoi KiB",
+              "png enc ms", "qoi enc ms", "png dec ms", "qoi dec ms", "speedup");
+  for(const auto& image: images) {
+    const auto width = static_cast<int>(image.width), height = static_cast<int>(image.height);
+    int png_size { 0 };
+    unsigned char* png { nullptr };
+    const double png_encode_ms = measure_ms([&] {
+      STBIW_FREE(png);
+      png = stbi_write_png_to_mem(image.rgba.data(), width * 4, width, height, 4, &png_size);
+    });
+    std::vector<std::uint8_t> qoi;
+    const double qoi_encode_ms = measure_ms([&] {
+      qoi = encode_qoi(image.rgba.data(), image.width, image.height, 4);
+    });
+
+    const double png_decode_ms = measure_ms([&] {
+      int w { 0 }, h { 0 }, channels { 0 };
+      stbi_image_free(stbi_load_from_memory(png, png_size, &w, &h, &channels, 4));
+    });
+    std::vector<std::uint8_t> pixels(image.rgba.size());
+    const double qoi_decode_ms = measure_ms([&] {
+      if(!decode_qoi(qoi.data(), qoi.size(), pixels.data(), 4)) {
+        std::printf("qoi decode failed\n");
+      }
+    });
+    if(pixels != image.rgba) {
+      std::printf("qoi round trip mismatch for %s\n", image.name.c_str());
+    }
+
+    std::printf("%-32s %10.1f %10.1f %12.2f %12.2f %12.2f %12.2f %7.1fx\n", image.name.c_str(),
+                png_size / 1024.0, static_cast<double>(qoi.size()) / 1024.0,
+                png_encode_ms, qoi_encode_ms, png_decode_ms, qoi_decode_ms, png_decode_ms / qoi_decode_ms);
+    STBIW_FREE(png);
+  }
+  return 0;
+}
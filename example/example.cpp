@@ -5,10 +5,16 @@
 #include <circle.hpp>
 #include <renderer.hpp>
 #include <label.hpp>
+#include <frame_readback.hpp>
+#include <async_texture_loader.hpp>
+#include <qoi.hpp>
+#include <profiler.hpp>
 #include <GLFW/glfw3.h>
 #include <glad/glad.h> // load after GLFW
 #include <numbers>
 #include <iostream>
+#include <fstream>
+#include <string>
 
 // it's only single file that shows fre2d example window; so it's okay to keep
 // it in global scope.
@@ -56,14 +62,21 @@ int main() {
 
 
   // we need to enable blending for text rendering.
-  // TODO: this might be moved into Renderer initialize() function
-  glEnable(GL_BLEND);
+  // BlendModePremultiplied is an option too, if textures are loaded with premultiply_alpha.
+  Renderer::set_blend_mode(BlendModeAlpha);
   glEnable(GL_DEBUG_OUTPUT);
   glDebugMessageCallback(error_callback, 0);
-  glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+  // press F to print timings of latest finished frame.
+  Profiler::get().set_enabled(true);
+
+  // 2D scene does not use depth or stencil; so we only allocate color buffer.
+  const RenderTargetDesc color_only_desc { { ColorRgba8 }, DepthStencilNone };
+  // default shaders write emissive color (see Drawable::set_emissive()) into
+  // second attachment; so one scene pass gives both color and glow.
+  const RenderTargetDesc scene_desc { { ColorRgba8, ColorRgba8 }, DepthStencilNone };
 
   // we will draw everything on to this framebuffer.
-  Framebuffer custom_framebuffer(Width, Height, false);
+  Framebuffer custom_framebuffer(Width, Height, scene_desc);
   Rectangle custom_framebuffer_quad(Width, Height, detail::drawable::default_position, detail::drawable::default_color);
 
 
@@ -71,22 +84,25 @@ int main() {
   constexpr auto main_framebuffer_fragment_shader = R"(
 #version 450 core
 in vec2 TexCoords;
+in vec2 UnscaledTexCoords;
 in vec4 Color;
 out vec4 FragColor;
 uniform sampler2D ScreenTexture; // main framebuffer
 uniform sampler2D SecondaryTexture; // secondary framebuffer (custom) pass
+uniform sampler2D EmissiveTexture; // second output of the same pass
 void main() {
-FragColor = texture(SecondaryTexture, TexCoords) * texture(ScreenTexture, TexCoords) * Color;
+vec4 emissive = texture(EmissiveTexture, UnscaledTexCoords);
+FragColor = texture(SecondaryTexture, UnscaledTexCoords) * texture(ScreenTexture, TexCoords) * Color;
+FragColor.rgb += emissive.rgb * 0.5f;
 }
   )";
 
   renderer = std::make_unique<Renderer>();
   
-  // create custom framebuffer with depth and stencil buffers attached to it.
-  // TODO: do it optional since in 2D depth and stencil buffers are not used
-  // frequently. also, do not use Framebuffer and Camera separately;
+  // create custom framebuffer without depth and stencil buffers.
+  // also, do not use Framebuffer and Camera separately;
   // otherwise you have to sync window size changes yourself.
-  renderer->attach_framebuffer(std::make_unique<Framebuffer>(Width, Height, false, main_framebuffer_vertex_shader, main_framebuffer_fragment_shader));
+  renderer->attach_framebuffer(std::make_unique<Framebuffer>(Width, Height, color_only_desc, main_framebuffer_vertex_shader, main_framebuffer_fragment_shader));
   renderer->attach_camera(std::make_unique<Camera>(Width, Height));
   renderer->attach_light_manager(std::make_unique<LightManager>());
 
@@ -121,10 +137,11 @@ FragColor = texture(SecondaryTexture, TexCoords) * texture(ScreenTexture, TexCoo
 
   renderer->get_light_manager()->update_buffers();
 
-  // we attach SecondaryTexture uniform texture into main framebuffer.
-  renderer->get_framebuffer()->set_additional_textures(std::vector {
-      AdditionalTexturesInfo{1, "SecondaryTexture", custom_framebuffer.get_color_buffer()}
-  });
+  // we attach both outputs of custom framebuffer into main framebuffer;
+  // as SecondaryTexture (slot 1) and EmissiveTexture (slot 2).
+  renderer->get_framebuffer()->set_additional_textures(
+      custom_framebuffer.get_color_buffers_as_additional_textures(1, { "SecondaryTexture", "EmissiveTexture" })
+  );
 
   // create shader program using default shaders
   Shader default_shader(detail::shader::default_vertex, detail::shader::default_fragment);
@@ -132,9 +149,15 @@ FragColor = texture(SecondaryTexture, TexCoords) * texture(ScreenTexture, TexCoo
   // framebuffer and camera stored as unique_ptr within Renderer class.
   const auto& fb = renderer->get_framebuffer();
 
-  // load texture
-  Texture tex("../../example/gechland.apartment.png");
-  Texture tex1("../../example/gechland.icon.png");
+  // shared by async texture loading and screenshot encoding.
+  ThreadPool workers;
+  AsyncTextureLoader loader(workers);
+
+  // load texture; decoded on worker threads. objects using them draw with
+  // default texture until loader.update() uploads them.
+  Texture tex, tex1;
+  tex.load_async(loader, "../../example/gechland.apartment.png");
+  tex1.load_async(loader, "../../example/gechland.icon.png");
 
   Rectangle rect(
     500,
@@ -208,6 +231,24 @@ FragColor = texture(SecondaryTexture, TexCoords) * texture(ScreenTexture, TexCoo
 
   label.set_ignore_zoom(true);
   label.set_affected_by_light(false);
+  label.set_emissive(1.f);
+
+  // press P to save custom framebuffer as screenshot_N.qoi; pixels are read
+  // back asynchronously and encoded by worker thread, render loop never waits.
+  FrameReadback readback([](ReadbackFrame& frame) {
+    // OpenGL rows are bottom to top.
+    const auto bytes = encode_qoi(
+      frame.pixels.data(),
+      static_cast<std::uint32_t>(frame.width),
+      static_cast<std::uint32_t>(frame.height),
+      4,
+      true
+    );
+    std::ofstream file("screenshot_" + std::to_string(frame.frame_index) + ".qoi", std::ios::binary);
+    file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+  }, &workers);
+  bool screenshot_key_down { false };
+  bool profile_key_down { false };
 
   // used for delta time calculation
   float last_frame { 0.0f };
@@ -237,6 +278,9 @@ FragColor = texture(SecondaryTexture, TexCoords) * texture(ScreenTexture, TexCoo
 
     window_key_process(window);
 
+    // uploads decoded textures, few MiB per frame at most.
+    loader.update();
+
     custom_framebuffer.call([&] {
       custom_framebuffer.clear_color(0.f, 0.f, 0.f, 1.f);
       x.set_rotation(static_cast<GLfloat>(glfwGetTime()));
@@ -261,6 +305,25 @@ FragColor = texture(SecondaryTexture, TexCoords) * texture(ScreenTexture, TexCoo
       label.draw(text_shader, renderer);
     });
 
+    const bool screenshot_key_pressed { glfwGetKey(window, GLFW_KEY_P) == GLFW_PRESS };
+    if(screenshot_key_pressed && !screenshot_key_down) {
+      readback.capture(custom_framebuffer);
+    }
+    screenshot_key_down = screenshot_key_pressed;
+    readback.poll();
+
+    const bool profile_key_pressed { glfwGetKey(window, GLFW_KEY_F) == GLFW_PRESS };
+    if(profile_key_pressed && !profile_key_down) {
+      if(const auto* frame = Profiler::get().get_frame()) {
+        std::cout << "frame " << frame->frame_index << ": cpu " << frame->cpu_ms << " ms, gpu " << frame->gpu_ms << " ms\n";
+        for(const auto& scope: frame->scopes) {
+          std::cout << std::string(scope.depth * 2 + 2, ' ') << scope.name << " x" << scope.calls
+                    << ": cpu " << scope.cpu_ms << " ms, gpu " << scope.gpu_ms << " ms\n";
+        }
+      }
+    }
+    profile_key_down = profile_key_pressed;
+
     custom_framebuffer.render_texture();
 
     // automatically bind and unbind framebuffer; this can be added to
@@ -282,7 +345,14 @@ FragColor = texture(SecondaryTexture, TexCoords) * texture(ScreenTexture, TexCoo
     // swap buffers and poll IO events
     glfwSwapBuffers(window);
     glfwPollEvents();
+    // deletes resources released in this frame.
+    ResourceRegistry::get().end_frame();
+    Profiler::get().end_frame();
   }
+  readback.flush();
+  // everything still alive; context is gone after glfwTerminate().
+  Profiler::get().clear();
+  ResourceRegistry::get().clear();
   glfwTerminate();
   return 0;
 }
@@ -0,0 +1,68 @@
+#include <headless_context.hpp>
+#include <frame_readback.hpp>
+#include <rectangle.hpp>
+#include <circle.hpp>
+#include <renderer.hpp>
+#include <sampler_cache.hpp>
+#include <fstream>
+#include <iostream>
+
+// renders one frame into offscreen framebuffer without window or display server,
+// then writes it as headless.ppm. works on servers and CI machines without gpu
+// through Mesa llvmpipe.
+using namespace fre2d;
+
+constexpr GLsizei Width { 800 };
+constexpr GLsizei Height { 600 };
+
+int main() {
+  HeadlessContext context;
+  if(!context.initialize()) {
+    return -1;
+  }
+  std::cout << "renderer: " << context.get_renderer_name() << '\n';
+
+  {
+    const RenderTargetDesc color_only_desc { { ColorRgba8 }, DepthStencilNone };
+    auto renderer = std::make_unique<Renderer>();
+    renderer->attach_framebuffer(std::make_unique<Framebuffer>(Width, Height, color_only_desc));
+    renderer->attach_camera(std::make_unique<Camera>(Width, Height));
+    renderer->attach_light_manager(std::make_unique<LightManager>());
+    renderer->get_light_manager()->initialize();
+    renderer->get_light_manager()->get_ambient_light_mutable().set_color(glm::vec4(1.f, 1.f, 1.f, 1.f));
+
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+    Shader default_shader(detail::shader::default_vertex, detail::shader::default_fragment);
+    Shader circle_shader(detail::circle::default_vertex, detail::circle::default_fragment);
+    Rectangle rect(300, 200, glm::vec2(-150.f, 100.f), glm::vec4(0.2f, 0.4f, 1.f, 1.f));
+    Circle ring(250, 250, glm::vec2(150.f, -100.f), glm::vec4(1.f, 0.f, 1.f, 1.f), 0.3f);
+
+    const auto& fb = renderer->get_framebuffer();
+    fb->call([&] {
+      fb->clear_color(1.f, 1.f, 1.f, 1.f);
+      rect.draw(default_shader, renderer);
+      ring.draw(circle_shader, renderer);
+    });
+
+    FrameReadback readback([](ReadbackFrame& frame) {
+      std::ofstream file("headless.ppm", std::ios::binary);
+      file << "P6\n" << frame.width << ' ' << frame.height << "\n255\n";
+      for(GLsizei y = frame.height - 1; y >= 0; --y) {
+        for(GLsizei x = 0; x < frame.width; ++x) {
+          file.write(reinterpret_cast<const char*>(&frame.pixels[(static_cast<std::size_t>(y) * frame.width + x) * 4]), 3);
+        }
+      }
+      std::cout << "written headless.ppm\n";
+    });
+    readback.capture(*fb);
+    readback.flush();
+    ResourceRegistry::get().end_frame();
+  }
+  // objects above only dropped their resources; samplers and resources are
+  // deleted here, while context is still current.
+  SamplerCache::get().clear();
+  ResourceRegistry::get().clear();
+  return 0;
+}
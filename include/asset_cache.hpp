@@ -0,0 +1,128 @@
+// MIT License
+//
+// Copyright (c) 2025 Ferhat Geçdoğan All Rights Reserved.
+// Distributed under the terms of the MIT License.
+//
+#pragma once
+
+#include "texture.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace fre2d {
+class AsyncTextureLoader;
+
+namespace detail::asset_cache {
+static constexpr bool default_hash_contents { false };
+} // namespace fre2d::detail::asset_cache
+
+struct AssetCacheStats {
+  std::size_t hits; // same file (canonical path) with same options.
+  std::size_t content_hits; // other path, same bytes; only with hash_contents.
+  std::size_t misses; // decoded and uploaded.
+  std::size_t coalesced; // hits on texture that is still being decoded; counted in hits too.
+  // gpu bytes that hits would have allocated, as GpuMemoryTracker tracks
+  // them; hits are counted once their texture is uploaded (and not evicted).
+  std::size_t bytes_saved;
+};
+
+// shares one Texture between every request for the same file, so entities
+// loading same sprite cost one decode and one gpu texture. key is canonical
+// path plus load options (filtering, wrapping, format, premultiply); with
+// hash_contents = true, files are also hashed on miss, so copies of same
+// image under different paths share too.
+//
+// requests through load_async() for a file that is still being decoded get
+// the same (pending) Texture; so concurrent requests coalesce into one
+// decode job. contents are not hashed there, that would read file on
+// render thread.
+//
+// cache owns its textures: release() drops one use and releases texture
+// with last one; destructor releases every texture. render thread only.
+class AssetCache {
+public:
+  explicit AssetCache(bool hash_contents = detail::asset_cache::default_hash_contents) noexcept;
+  ~AssetCache() noexcept;
+
+  AssetCache(const AssetCache&) = delete;
+  AssetCache& operator=(const AssetCache&) = delete;
+
+  // same parameters as Texture::load(). failed loads are not cached, so
+  // they are retried next time; returned texture is empty then.
+  [[nodiscard]] Texture load(
+    const char* file_path,
+    bool use_nearest = detail::texture::default_use_nearest,
+    bool use_mipmap = detail::texture::default_use_mipmap,
+    const Texture::WrapOptions& texture_wrap = Texture::WrapOptions::default_value(),
+    TextureFormat format = detail::texture::default_format,
+    bool premultiply_alpha = detail::texture::default_premultiply_alpha
+  ) noexcept;
+
+  // same parameters as Texture::load_async(); shares entries with load()
+  // for default format. file that fails to decode stays cached as empty
+  // texture (binds default one) until it's released.
+  [[nodiscard]] Texture load_async(
+    AsyncTextureLoader& loader,
+    const char* file_path,
+    bool use_nearest = detail::texture::default_use_nearest,
+    bool use_mipmap = detail::texture::default_use_mipmap,
+    const Texture::WrapOptions& texture_wrap = Texture::WrapOptions::default_value(),
+    bool premultiply_alpha = detail::texture::default_premultiply_alpha
+  ) noexcept;
+
+  // drops one use of texture; it's released when no use is left.
+  // textures that are not from this cache are ignored.
+  void release(const Texture& texture) noexcept;
+  // releases every texture, whatever their use counts are.
+  void clear() noexcept;
+
+  // uses are loads minus release() calls.
+  [[nodiscard]] std::size_t get_use_count(const Texture& texture) const noexcept;
+  [[nodiscard]] std::size_t get_entry_count() const noexcept;
+  [[nodiscard]] AssetCacheStats get_stats() const noexcept;
+  void reset_stats() noexcept;
+  [[nodiscard]] const bool& get_hash_contents() const noexcept;
+private:
+  struct LoadOptions {
+    GLuint wrap_x;
+    GLuint wrap_y;
+    TextureFormat format;
+    bool use_nearest;
+    bool use_mipmap;
+    bool premultiply_alpha;
+
+    friend auto operator<=>(const LoadOptions& lhs, const LoadOptions& rhs) noexcept = default;
+  };
+
+  using PathKey = std::pair<std::string, LoadOptions>;
+  using ContentKey = std::pair<std::uint64_t, LoadOptions>;
+
+  struct Entry {
+    Texture texture;
+    LoadOptions options;
+    std::vector<std::string> paths; // every canonical path that maps to it.
+    std::uint64_t content_hash;
+    bool has_content_hash;
+    std::size_t use_count;
+    std::size_t hit_count; // for bytes_saved.
+  };
+
+  [[nodiscard]] Texture* _find(const std::string& path, const LoadOptions& options) noexcept;
+  Entry& _insert(const std::string& path, const LoadOptions& options, const Texture& texture) noexcept;
+  void _erase(std::unordered_map<std::uint32_t, Entry>::iterator entry) noexcept;
+  [[nodiscard]] static std::size_t _get_gpu_bytes(const Entry& entry) noexcept;
+  [[nodiscard]] static std::string _canonicalize(const char* file_path) noexcept;
+
+  std::unordered_map<std::uint32_t, Entry> _entries; // by TextureHandle::value.
+  std::map<PathKey, std::uint32_t> _paths;
+  std::map<ContentKey, std::uint32_t> _contents;
+  AssetCacheStats _stats;
+  std::size_t _released_bytes_saved; // of entries that are gone.
+  bool _hash_contents;
+};
+} // namespace fre2d
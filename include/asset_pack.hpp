@@ -0,0 +1,114 @@
+// MIT License
+//
+// Copyright (c) 2025 Ferhat Geçdoğan All Rights Reserved.
+// Distributed under the terms of the MIT License.
+//
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// .f2pak: single file that holds many assets, ready to be used as is; opened
+// once and memory mapped, so loading asset is lookup + gpu upload (or
+// FT_New_Memory_Face) straight from mapped pages, without open/decode.
+//
+// layout (little endian):
+//   magic "F2PK", u32 version, u32 entry count, u32 reserved
+//   entry table, sorted by name: u32 name offset, u32 name size, u32 type,
+//     u32 width, u32 height, u32 channels, u64 data offset, u64 data size
+//   names, then data of each entry aligned to data_alignment.
+// offsets are from start of file. pixels are bottom to top like Texture::load().
+namespace fre2d {
+namespace detail::asset_pack {
+static constexpr std::array<std::uint8_t, 4> magic { 'F', '2', 'P', 'K' };
+static constexpr std::uint32_t version { 1 };
+static constexpr std::size_t header_size { 16 };
+static constexpr std::size_t entry_size { 40 };
+static constexpr std::size_t data_alignment { 16 };
+} // namespace fre2d::detail::asset_pack
+
+enum AssetType : std::uint32_t {
+  AssetTypeRaw, // bytes as is.
+  AssetTypePixels, // decoded 8-bit RGB(A); width, height and channels are set.
+  AssetTypeCompressed, // .f2tc file (see compressed_texture.hpp).
+  AssetTypeFont // font file that FreeType can read.
+};
+
+struct AssetEntry {
+  std::string_view name;
+  AssetType type;
+  std::uint32_t width;
+  std::uint32_t height;
+  std::uint32_t channels;
+  const std::uint8_t* data; // points into mapping; valid while AssetPack is open.
+  std::size_t size;
+};
+
+// read-only view of .f2pak file. lookups are binary search over mapped
+// entry table, so opening pack allocates nothing per entry. Texture and
+// Font keep no reference to pack after loading, except Font with
+// AssetTypeFont; FreeType reads glyphs from mapping, so pack must outlive it.
+class AssetPack {
+public:
+  AssetPack() noexcept = default;
+  explicit AssetPack(const char* file_path) noexcept;
+  ~AssetPack() noexcept;
+
+  AssetPack(const AssetPack&) = delete;
+  AssetPack& operator=(const AssetPack&) = delete;
+
+  // maps file and validates header and entry table; logs error and returns
+  // false otherwise. closes previously opened pack.
+  bool open(const char* file_path) noexcept;
+  void close() noexcept;
+
+  [[nodiscard]] std::optional<AssetEntry> find(std::string_view name) const noexcept;
+  [[nodiscard]] AssetEntry get_entry(std::size_t index) const noexcept;
+
+  [[nodiscard]] bool is_open() const noexcept;
+  [[nodiscard]] const std::size_t& get_entry_count() const noexcept;
+  [[nodiscard]] const std::size_t& get_size() const noexcept;
+private:
+  const std::uint8_t* _data { nullptr };
+  std::size_t _size { 0 };
+  std::size_t _entry_count { 0 };
+#if defined(_WIN32)
+  void* _file_handle { nullptr };
+  void* _mapping_handle { nullptr };
+#endif
+};
+
+// builds .f2pak in memory; used by fre2d_pack tool.
+class AssetPackWriter {
+public:
+  // name must be unique; data is copied.
+  void add(
+    std::string name,
+    AssetType type,
+    const std::uint8_t* data,
+    std::size_t size,
+    std::uint32_t width = 0,
+    std::uint32_t height = 0,
+    std::uint32_t channels = 0
+  ) noexcept;
+
+  [[nodiscard]] std::vector<std::uint8_t> write() const noexcept;
+  [[nodiscard]] std::size_t get_entry_count() const noexcept;
+private:
+  struct Entry {
+    std::string name;
+    AssetType type;
+    std::uint32_t width;
+    std::uint32_t height;
+    std::uint32_t channels;
+    std::vector<std::uint8_t> data;
+  };
+
+  std::vector<Entry> _entries;
+};
+} // namespace fre2d
@@ -0,0 +1,95 @@
+// MIT License
+//
+// Copyright (c) 2025 Ferhat Geçdoğan All Rights Reserved.
+// Distributed under the terms of the MIT License.
+//
+#pragma once
+
+#include "texture.hpp"
+#include "pixel_upload_ring.hpp"
+#include "thread_pool.hpp"
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+
+namespace fre2d {
+namespace detail::async_texture_loader {
+// ~1 ms of uploads on typical desktop drivers.
+static constexpr std::size_t default_upload_budget { 4 * 1024 * 1024 };
+} // namespace fre2d::detail::async_texture_loader
+
+// decodes image files on ThreadPool workers, then uploads them on render
+// thread in update() under per-frame byte budget. see Texture::load_async().
+// workers copy decoded pixels into PixelUploadRing (qoi files are decoded
+// right into it), so uploads are plain pbo copies; images that don't fit
+// into ring are uploaded from client memory.
+// construct it with context current, ring is created immediately.
+class AsyncTextureLoader {
+public:
+  explicit AsyncTextureLoader(
+    ThreadPool& workers,
+    std::size_t ring_capacity = detail::pixel_upload_ring::default_capacity
+  ) noexcept;
+  // waits for running decode jobs, then drops images that are not uploaded.
+  ~AsyncTextureLoader() noexcept;
+
+  AsyncTextureLoader(const AsyncTextureLoader&) = delete;
+  AsyncTextureLoader& operator=(const AsyncTextureLoader&) = delete;
+
+  // call once per frame on render thread; uploads decoded images until
+  // byte_budget is used. at least one image is uploaded if any is ready,
+  // so big images can't starve. returns uploaded bytes.
+  std::size_t update(std::size_t byte_budget = detail::async_texture_loader::default_upload_budget) noexcept;
+  // blocks until every queued image is decoded and uploaded (e.g. loading screens).
+  void finish() noexcept;
+
+  // images that are being decoded or waiting for upload.
+  [[nodiscard]] std::size_t get_pending_count() const noexcept;
+  [[nodiscard]] std::size_t get_ready_count() const noexcept;
+  [[nodiscard]] const PixelUploadRing& get_upload_ring() const noexcept;
+private:
+  friend class Texture;
+  friend class GpuMemoryTracker; // reloads evicted textures.
+
+  struct DecodedImage {
+    TextureHandle target; // Texture::_handle of texture to upload into
+    std::string file_path;
+    UploadSpan span; // pixels in upload ring, if there was room.
+    std::shared_ptr<unsigned char> pixels; // nullptr if decoding failed or span is used.
+    GLsizei width;
+    GLsizei height;
+    int channels;
+    bool use_nearest;
+    bool use_mipmap;
+    Texture::WrapOptions texture_wrap;
+    // full sampler state of evicted texture, restored after upload.
+    std::optional<SamplerDesc> sampler;
+  };
+
+  // shared with decode jobs; destructor waits for them, since they write into _ring.
+  struct SharedState {
+    std::mutex mutex;
+    std::condition_variable decoded;
+    std::deque<DecodedImage> ready;
+    std::size_t decoding_count { 0 };
+  };
+
+  void _enqueue(
+    TextureHandle target,
+    const char* file_path,
+    bool use_nearest,
+    bool use_mipmap,
+    const Texture::WrapOptions& texture_wrap,
+    bool premultiply_alpha,
+    const std::optional<SamplerDesc>& sampler = std::nullopt
+  ) noexcept;
+
+  ThreadPool& _workers;
+  PixelUploadRing _ring;
+  std::shared_ptr<SharedState> _state;
+};
+} // namespace fre2d
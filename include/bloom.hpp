@@ -0,0 +1,159 @@
+// MIT License
+//
+// Copyright (c) 2025 Ferhat Geçdoğan All Rights Reserved.
+// Distributed under the terms of the MIT License.
+//
+#pragma once
+
+#include "render_target_pool.hpp"
+#include <vector>
+
+namespace fre2d {
+namespace detail::bloom {
+// dual kawase filter (Marius Bjorge, "Bandwidth-Efficient Rendering", SIGGRAPH 2015).
+// every downsample halves resolution, so whole chain costs ~1/3 of one
+// full resolution pass no matter how many levels are used.
+static constexpr auto downsample_fragment =
+R"(#version 450 core
+in vec2 TexCoords;
+out vec4 FragColor;
+uniform sampler2D ScreenTexture;
+uniform vec2 TexelSize; /* of source texture */
+uniform vec2 UvMax; /* source might be over-allocated, do not sample outside */
+uniform float Offset;
+uniform bool Prefilter;
+uniform float Threshold;
+uniform float Knee;
+
+vec4 fetch(vec2 uv) {
+  return texture(ScreenTexture, clamp(uv, vec2(0.f), UvMax));
+}
+
+void main() {
+  vec2 half_pixel = TexelSize * 0.5f * Offset;
+  vec4 sum = fetch(TexCoords) * 4.f;
+  sum += fetch(TexCoords - half_pixel);
+  sum += fetch(TexCoords + half_pixel);
+  sum += fetch(TexCoords + vec2(half_pixel.x, -half_pixel.y));
+  sum += fetch(TexCoords - vec2(half_pixel.x, -half_pixel.y));
+  vec4 color = sum / 8.f;
+  if(Prefilter) {
+    /* quadratic soft knee, only bright parts bloom */
+    float brightness = max(color.r, max(color.g, color.b));
+    float soft = clamp(brightness - Threshold + Knee, 0.f, 2.f * Knee);
+    soft = soft * soft / (4.f * Knee + 0.00001f);
+    color.rgb *= max(soft, brightness - Threshold) / max(brightness, 0.00001f);
+  }
+  FragColor = color;
+})";
+
+static constexpr auto upsample_fragment =
+R"(#version 450 core
+in vec2 TexCoords;
+out vec4 FragColor;
+uniform sampler2D ScreenTexture;
+uniform vec2 TexelSize;
+uniform vec2 UvMax;
+uniform float Offset;
+
+vec4 fetch(vec2 uv) {
+  return texture(ScreenTexture, clamp(uv, vec2(0.f), UvMax));
+}
+
+void main() {
+  vec2 half_pixel = TexelSize * 0.5f * Offset;
+  vec4 sum = fetch(TexCoords + vec2(-half_pixel.x * 2.f, 0.f));
+  sum += fetch(TexCoords + vec2(-half_pixel.x, half_pixel.y)) * 2.f;
+  sum += fetch(TexCoords + vec2(0.f, half_pixel.y * 2.f));
+  sum += fetch(TexCoords + vec2(half_pixel.x, half_pixel.y)) * 2.f;
+  sum += fetch(TexCoords + vec2(half_pixel.x * 2.f, 0.f));
+  sum += fetch(TexCoords + vec2(half_pixel.x, -half_pixel.y)) * 2.f;
+  sum += fetch(TexCoords + vec2(0.f, -half_pixel.y * 2.f));
+  sum += fetch(TexCoords + vec2(-half_pixel.x, -half_pixel.y)) * 2.f;
+  FragColor = sum / 12.f;
+})";
+
+static constexpr auto composite_vertex =
+fre2d_default_glsl_version
+fre2d_default_buffer_layouts
+R"(
+out vec2 TexCoords;
+out vec2 BloomTexCoords;
+out vec4 Color;
+uniform vec2 TexCoordsScale;
+uniform vec2 BloomTexCoordsScale;
+void main() {
+  gl_Position = vec4(attr_Position, 0.f, 1.f);
+  TexCoords = attr_TexCoords * TexCoordsScale;
+  BloomTexCoords = attr_TexCoords * BloomTexCoordsScale;
+  Color = attr_Color;
+}
+)";
+
+static constexpr auto composite_fragment =
+R"(#version 450 core
+in vec2 TexCoords;
+in vec2 BloomTexCoords;
+in vec4 Color;
+out vec4 FragColor;
+uniform sampler2D ScreenTexture;
+uniform sampler2D BloomTexture;
+uniform float Intensity;
+void main() {
+  vec4 bloom = texture(BloomTexture, BloomTexCoords) * Intensity;
+  FragColor = (texture(ScreenTexture, TexCoords) + vec4(bloom.rgb, 0.f)) * Color;
+})";
+
+static constexpr GLfloat default_radius { 16.f };
+static constexpr GLfloat default_threshold { 0.8f };
+static constexpr GLfloat default_knee { 0.3f };
+static constexpr GLfloat default_intensity { 1.f };
+static constexpr std::size_t max_levels { 8 };
+// lowest unit; apply() moves it above additional textures of input.
+static constexpr GLint bloom_texture_unit { 1 };
+} // namespace fre2d::detail::bloom
+
+// blur and bloom using mip-style downsample/upsample chain.
+// intermediate targets are RGBA16F and come from RenderTargetPool.
+class Bloom {
+public:
+  explicit Bloom(RenderTargetPool& pool) noexcept;
+
+  // approximate blur radius in pixels of input; bigger radius adds levels,
+  // which are cheaper than previous ones; so cost stays almost the same.
+  void set_radius(GLfloat radius) noexcept;
+  // only pixels brighter than threshold bloom; knee smooths the cut.
+  void set_threshold(GLfloat threshold, GLfloat knee = detail::bloom::default_knee) noexcept;
+  void set_intensity(GLfloat intensity) noexcept;
+
+  // writes blurred input into output (default framebuffer if nullptr).
+  void blur(Framebuffer& input, Framebuffer* output = nullptr) noexcept;
+  // input + blurred bright parts of input into output (default framebuffer if nullptr).
+  void apply(Framebuffer& input, Framebuffer* output = nullptr) noexcept;
+
+  [[nodiscard]] const GLfloat& get_radius() const noexcept;
+  [[nodiscard]] const GLfloat& get_threshold() const noexcept;
+  [[nodiscard]] const GLfloat& get_knee() const noexcept;
+  [[nodiscard]] const GLfloat& get_intensity() const noexcept;
+  [[nodiscard]] const std::size_t& get_level_count() const noexcept;
+private:
+  void _initialize_shaders() noexcept;
+  // fills _levels with targets, returns level that holds blurred (half resolution) result.
+  Framebuffer& _run_chain(Framebuffer& input, bool prefilter) noexcept;
+  void _draw_pass(Framebuffer& source, Framebuffer* target, const Shader& shader, GLsizei width, GLsizei height) const noexcept;
+  void _release_levels() noexcept;
+
+  RenderTargetPool& _pool;
+  RenderTargetDesc _level_desc;
+  std::vector<Framebuffer*> _levels;
+  Shader _downsample_shader;
+  Shader _upsample_shader;
+  Shader _composite_shader;
+  GLfloat _radius;
+  GLfloat _offset;
+  GLfloat _threshold;
+  GLfloat _knee;
+  GLfloat _intensity;
+  std::size_t _level_count;
+};
+} // namespace fre2d
@@ -42,8 +42,10 @@ in vec4 Color;
 in vec2 Position;
 in vec2 FragPos;
 
-out vec4 FragColor;
-
+layout (location = 0) out vec4 FragColor;
+)"
+fre2d_default_emissive_output
+R"(
 /* those uniforms are automatically passed by fre2d */
 uniform sampler2D TextureSampler;
 uniform bool UseTexture;
@@ -53,6 +55,7 @@ uniform bool AffectedByLight;
 fre2d_default_lighting_fragment
 fre2d_default_color_func
 fre2d_default_point_lights_blend_func
+fre2d_default_premultiply_func
 R"(
 void main() {
   vec4 default_color = calculate_color(Color, TextureSampler, TexCoords, UseTexture);
@@ -74,6 +77,11 @@ void main() {
     1.f - float(AffectedByLight)
   );
   FragColor *= default_color;
+  EmissiveColor = vec4(default_color.rgb * Emissive, default_color.a);
+
+  float texture_alpha = mix(1.f, default_color.a / max(Color.a, 1e-5), float(UseTexture));
+  FragColor = premultiply_output(FragColor, texture_alpha);
+  EmissiveColor = premultiply_output(EmissiveColor, texture_alpha);
 }
 )";
 } // namespace fre2d::detail::circle
@@ -0,0 +1,91 @@
+// MIT License
+//
+// Copyright (c) 2025 Ferhat Geçdoğan All Rights Reserved.
+// Distributed under the terms of the MIT License.
+//
+#pragma once
+
+#include <glad/glad.h>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// block compressed textures (BCn); gpu samples them directly, so they take
+// 4-8x less memory than RGBA8 and are uploaded without decoding.
+//
+// .f2tc container (little endian):
+//   magic "F2TC", u32 version, u32 BlockFormat, u32 width, u32 height,
+//   u32 level count; then for each level: u32 byte size, blocks.
+// rows are bottom to top like Texture::load(); fre2d_texc writes them so.
+namespace fre2d {
+namespace detail::compressed_texture {
+static constexpr std::array<std::uint8_t, 4> magic { 'F', '2', 'T', 'C' };
+static constexpr std::uint32_t version { 1 };
+static constexpr std::size_t header_size { 24 };
+static constexpr std::uint32_t block_dimension { 4 }; // every BCn block is 4x4 pixels.
+
+// EXT_texture_compression_s3tc is not core (BPTC and RGTC are), our glad has no extensions.
+static constexpr GLenum compressed_rgba_s3tc_dxt1 { 0x83F1 };
+static constexpr GLenum compressed_rgba_s3tc_dxt5 { 0x83F3 };
+} // namespace fre2d::detail::compressed_texture
+
+enum BlockFormat : std::uint32_t {
+  BlockFormatBc1, // RGB + 1-bit alpha, 8 bytes per block.
+  BlockFormatBc3, // RGBA, 16 bytes per block.
+  BlockFormatBc4, // single channel (red), 8 bytes per block.
+  BlockFormatBc7  // RGBA, higher quality than BC3; 16 bytes per block.
+};
+
+struct CompressedLevel {
+  std::uint32_t width;
+  std::uint32_t height;
+  std::vector<std::uint8_t> blocks;
+};
+
+struct CompressedImage {
+  BlockFormat format;
+  std::vector<CompressedLevel> levels; // level 0 first.
+};
+
+// level that points into .f2tc data instead of owning blocks.
+struct CompressedLevelView {
+  std::uint32_t width;
+  std::uint32_t height;
+  const std::uint8_t* blocks;
+  std::size_t size;
+};
+
+[[nodiscard]] GLenum get_block_format_internal_format(BlockFormat format) noexcept;
+[[nodiscard]] std::size_t get_block_format_block_bytes(BlockFormat format) noexcept;
+[[nodiscard]] const char* get_block_format_name(BlockFormat format) noexcept;
+// needs current context; BC1/BC3 depend on EXT_texture_compression_s3tc.
+[[nodiscard]] bool is_block_format_supported(BlockFormat format) noexcept;
+
+// encodes block rows [first_block_row, last_block_row) of tightly packed
+// RGBA8 image into blocks (which holds every block of the image). blocks on
+// right/top edge repeat edge pixels. rows are independent, so they can be
+// encoded on several threads.
+void encode_block_rows(
+  BlockFormat format,
+  const std::uint8_t* rgba,
+  std::uint32_t width,
+  std::uint32_t height,
+  std::uint32_t first_block_row,
+  std::uint32_t last_block_row,
+  std::uint8_t* blocks
+) noexcept;
+
+[[nodiscard]] std::size_t get_compressed_level_size(BlockFormat format, std::uint32_t width, std::uint32_t height) noexcept;
+
+[[nodiscard]] std::vector<std::uint8_t> write_compressed_texture(const CompressedImage& image) noexcept;
+// returns false (and logs) if data is not valid .f2tc.
+[[nodiscard]] bool read_compressed_texture(const std::uint8_t* data, std::size_t size, CompressedImage& image) noexcept;
+// same, but without copying blocks; views are valid as long as data is.
+[[nodiscard]] bool read_compressed_texture_levels(
+  const std::uint8_t* data,
+  std::size_t size,
+  BlockFormat& format,
+  std::vector<CompressedLevelView>& levels
+) noexcept;
+} // namespace fre2d
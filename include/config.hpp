@@ -16,6 +16,12 @@ layout (location = 2) in vec2 attr_TexCoords;
 )" \
 fre2d_newline
 
+/* atlas page (texture array layer) of vertex; only used by array shaders. */
+#define fre2d_default_layer_layout R"(
+layout (location = 3) in float attr_Layer;
+)" \
+fre2d_newline
+
 #define fre2d_default_uniforms R"(
 /* those uniforms are automatically passed by fre2d */
 uniform mat4 Model;
@@ -42,17 +48,56 @@ vec4 calculate_color(vec4 color, sampler2D tex, vec2 tex_coords, bool use_textur
 )" \
 fre2d_newline
 
+#define fre2d_default_emissive_output R"(
+/* second color output; ignored unless framebuffer has second color attachment.
+   Emissive (0 by default) scales glow; drawables with 0 only occlude. */
+layout (location = 1) out vec4 EmissiveColor;
+uniform float Emissive;
+)" \
+fre2d_newline
+
 #define fre2d_default_point_lights_blend_func R"(
-vec4 point_lights_blend_func(vec4 Color, float alpha_ch, sampler2D tex, vec2 tex_coords, vec2 frag_pos) {
+vec4 point_lights_blend_func(vec4 Color, float alpha_ch, vec2 frag_pos) {
   for(int i = 0; i < point_lights.length(); i++) {
     Color += mix(
-      vec4(calculate_point_light(point_lights[i], tex, tex_coords, frag_pos), alpha_ch),
+      vec4(calculate_point_light(point_lights[i], frag_pos), alpha_ch),
       vec4(0.f, 0.f, 0.f, 0.f),
       float(point_lights[i].disabled)
     );
   }
   return Color;
 }
+
+vec4 point_lights_blend_func(vec4 Color, float alpha_ch, sampler2D tex, vec2 tex_coords, vec2 frag_pos) {
+  return point_lights_blend_func(Color, alpha_ch, frag_pos);
+}
+)" \
+fre2d_newline
+
+/* scales straight color to premultiplied when PremultipliedAlpha is set
+   (BlendModePremultiplied). textures are premultiplied on load, so rgb already
+   carries texture_alpha (pass 1 for untextured or single channel sources);
+   only rest of alpha is applied. */
+#define fre2d_default_premultiply_func R"(
+uniform bool PremultipliedAlpha;
+
+vec4 premultiply_output(vec4 color, float texture_alpha) {
+  float scale = clamp(color.a, 0.f, 1.f) / max(texture_alpha, 1e-5);
+  return mix(color, vec4(color.rgb * scale, color.a), float(PremultipliedAlpha));
+}
+)" \
+fre2d_newline
+
+/* sampler2DArray overloads; tex_coords.z is layer. needs lighting and
+   point lights blend functions above. */
+#define fre2d_default_array_sampler_funcs R"(
+vec4 calculate_color(vec4 color, sampler2DArray tex, vec3 tex_coords, bool use_texture) {
+  return mix(color, color * texture(tex, tex_coords), float(use_texture));
+}
+
+vec4 point_lights_blend_func(vec4 Color, float alpha_ch, sampler2DArray tex, vec3 tex_coords, vec2 frag_pos) {
+  return point_lights_blend_func(Color, alpha_ch, frag_pos);
+}
 )" \
 fre2d_newline
 
@@ -82,7 +127,7 @@ layout(std430, binding = 0) buffer PointLights {
 // object.
 uniform AmbientLight global_ambient_light;
 
-vec3 calculate_point_light(PointLight light, sampler2D tex, vec2 tex_coords, vec2 frag_pos) {
+vec3 calculate_point_light(PointLight light, vec2 frag_pos) {
   vec3 ambient = vec3(light.ambient);
 
   vec3 norm = vec3(0.f, 0.f, 1.f);
@@ -100,6 +145,10 @@ vec3 calculate_point_light(PointLight light, sampler2D tex, vec2 tex_coords, vec
   return ambient + diffuse;
 }
 
+vec3 calculate_point_light(PointLight light, sampler2D tex, vec2 tex_coords, vec2 frag_pos) {
+  return calculate_point_light(light, frag_pos);
+}
+
 vec4 calculate_ambient_light(AmbientLight light) {
   return light.color;
 }
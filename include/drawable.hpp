@@ -23,6 +23,8 @@ static constexpr bool default_flip_vertically { false };
 static constexpr bool default_flip_horizontally { false };
 static constexpr bool default_ignore_zoom { false };
 static constexpr bool default_affected_by_light { true };
+// scale of color written into emissive output of default shaders; 0 = no glow.
+static constexpr GLfloat default_emissive { 0.f };
 } // namespace fre2d::detail::drawable
 
 class Camera;
@@ -47,6 +49,7 @@ public:
   void set_flip_vertically(bool flip_vertically) noexcept;
   void set_flip_horizontally(bool flip_horizontally) noexcept;
   void set_affected_by_light(bool affected_by_light) noexcept;
+  void set_emissive(GLfloat emissive) noexcept;
 
   [[nodiscard]] const glm::vec2& get_position() const noexcept;
   [[nodiscard]] const glm::vec3& get_scale() const noexcept;
@@ -67,6 +70,7 @@ public:
     GLfloat rotation_rads = detail::drawable::default_rotation_radians
   ) noexcept;
   [[nodiscard]] const bool& get_affected_by_light() const noexcept;
+  [[nodiscard]] const GLfloat& get_emissive() const noexcept;
 
   [[nodiscard]] const bool& is_matrix_update_required() const noexcept;
 
@@ -99,5 +103,6 @@ protected:
   bool _flip_vertically, _flip_horizontally;
   bool _ignore_zoom;
   bool _affected_by_light;
+  GLfloat _emissive;
 };
 } // namespace fre2d
\ No newline at end of file
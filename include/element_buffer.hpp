@@ -7,6 +7,7 @@
 
 #include <vector>
 #include <glad/glad.h>
+#include "resource_registry.hpp"
 
 namespace fre2d {
 namespace detail::element_buffer {
@@ -23,10 +24,10 @@ public:
   void unbind() const noexcept;
   void initialize(const std::vector<GLuint>& indices) noexcept;
 
-  [[nodiscard]] const GLuint& get_ebo_id() const noexcept;
+  [[nodiscard]] GLuint get_ebo_id() const noexcept;
   [[nodiscard]] const GLsizei& get_indices_count() const noexcept;
 private:
-  GLuint _ebo_id;
+  BufferHandle _handle;
   GLsizei _indices_count;
 };
 } // namespace fre2d
\ No newline at end of file
@@ -10,9 +10,12 @@
 #include "vertex_buffer.hpp"
 #include "texture.hpp"
 #include "shader.hpp"
+#include <string_view>
 #include <unordered_map>
 
 namespace fre2d {
+class AssetPack;
+
 namespace detail::font {
 static constexpr FT_UInt default_font_height { 36 };
 } // namespace fre2d::detail::font
@@ -35,6 +38,13 @@ public:
     const char* font_path,
     FT_UInt font_size = detail::font::default_font_height
   ) noexcept;
+  // pack must outlive Font; face reads glyphs from mapped file.
+  Font(
+    const FontManager& font_manager,
+    const AssetPack& pack,
+    std::string_view name,
+    FT_UInt font_size = detail::font::default_font_height
+  ) noexcept;
   ~Font() noexcept;
 
   void initialize_font(
@@ -42,8 +52,18 @@ public:
     const char* font_path,
     FT_UInt font_size = detail::font::default_font_height
   );
+
+  void initialize_font(
+    const FontManager& font_manager,
+    const AssetPack& pack,
+    std::string_view name,
+    FT_UInt font_size = detail::font::default_font_height
+  );
 private:
-  FreeType_Face* _face;
+  // renders characters of _face into textures.
+  void _load_characters();
+
+  FreeType_Face* _face { nullptr };
   FT_UInt _font_size;
   std::unordered_map<char, Character> _char_map;
 };
@@ -5,6 +5,7 @@
 //
 #pragma once
 
+#include <mutex>
 #include <type_traits>
 #include <ft2build.h>
 #include FT_FREETYPE_H
@@ -25,5 +26,8 @@ public:
   void initialize() const noexcept;
 
   [[nodiscard]] static bool is_initialized() noexcept;
+  // FT_Library is shared by every thread; FT_New_Face and FT_Done_Face
+  // modify it, so they are called with this locked.
+  [[nodiscard]] static std::mutex& get_library_mutex() noexcept;
 };
 } // namespace fre2d
\ No newline at end of file
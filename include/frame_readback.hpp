@@ -0,0 +1,81 @@
+// MIT License
+//
+// Copyright (c) 2025 Ferhat Geçdoğan All Rights Reserved.
+// Distributed under the terms of the MIT License.
+//
+#pragma once
+
+#include "framebuffer.hpp"
+#include "thread_pool.hpp"
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace fre2d {
+namespace detail::frame_readback {
+// frames in flight; gpu usually finishes copy 1-2 frames later.
+static constexpr std::size_t default_ring_size { 3 };
+static constexpr GLsizei bytes_per_pixel { 4 }; // GL_RGBA, GL_UNSIGNED_BYTE
+} // namespace fre2d::detail::frame_readback
+
+struct ReadbackFrame {
+  std::uint64_t frame_index;
+  GLsizei width;
+  GLsizei height;
+  // tightly packed RGBA8; rows are bottom to top like OpenGL.
+  std::vector<std::uint8_t> pixels;
+};
+
+using ReadbackCallback = std::function<void(ReadbackFrame&)>;
+
+// reads color buffers of offscreen Framebuffers without stalling the pipeline.
+// capture() records a copy into pixel-pack buffer and a fence, poll() hands
+// frames whose fence is signaled to callback; neither waits for gpu.
+// if thread pool is given, callback runs on its workers (so encoding is
+// off the render thread), otherwise it runs inside poll().
+class FrameReadback {
+public:
+  explicit FrameReadback(
+    ReadbackCallback callback,
+    ThreadPool* workers = nullptr,
+    std::size_t ring_size = detail::frame_readback::default_ring_size
+  ) noexcept;
+  ~FrameReadback() noexcept;
+
+  FrameReadback(const FrameReadback&) = delete;
+  FrameReadback& operator=(const FrameReadback&) = delete;
+
+  // returns false and drops the frame if every slot is still in flight.
+  bool capture(const Framebuffer& fb, std::size_t color_buffer_index = 0) noexcept;
+  // call once per frame (after capture() is fine); completed frames are
+  // delivered in capture order.
+  void poll() noexcept;
+  // blocks until every pending capture is delivered; use it before shutdown.
+  void flush() noexcept;
+
+  [[nodiscard]] std::size_t get_ring_size() const noexcept;
+  [[nodiscard]] std::size_t get_pending_count() const noexcept;
+  [[nodiscard]] const std::uint64_t& get_captured_count() const noexcept;
+  [[nodiscard]] const std::uint64_t& get_dropped_count() const noexcept;
+private:
+  struct Slot {
+    GLuint pbo_id;
+    GLsizeiptr capacity;
+    GLsync fence;
+    std::uint64_t frame_index;
+    GLsizei width;
+    GLsizei height;
+  };
+
+  // returns false if fence is not signaled yet (and timeout is 0).
+  bool _try_deliver(Slot& slot, GLuint64 timeout_ns) noexcept;
+
+  ReadbackCallback _callback;
+  ThreadPool* _workers;
+  std::vector<Slot> _slots;
+  std::size_t _next_slot; // oldest pending slot is _next_slot - pending count.
+  std::size_t _pending_count;
+  std::uint64_t _captured_count;
+  std::uint64_t _dropped_count;
+};
+} // namespace fre2d
@@ -5,6 +5,8 @@
 //
 #pragma once
 
+#include "profiler.hpp"
+#include "render_target.hpp"
 #include "renderbuffer.hpp"
 #include "shader.hpp"
 #include "texture.hpp"
@@ -20,10 +22,15 @@ fre2d_default_glsl_version
 fre2d_default_buffer_layouts
 R"(
 out vec2 TexCoords;
+/* 0..1 over whole quad; for additional textures, they are not over-allocated. */
+out vec2 UnscaledTexCoords;
 out vec4 Color;
+/* framebuffer might be over-allocated, we only sample rendered sub-rectangle. */
+uniform vec2 TexCoordsScale;
 void main() {
   gl_Position = vec4(attr_Position, 0.f, 1.f);
-  TexCoords = attr_TexCoords;
+  TexCoords = attr_TexCoords * TexCoordsScale;
+  UnscaledTexCoords = attr_TexCoords;
   Color = attr_Color;
 }
 )";
@@ -46,17 +53,39 @@ static constexpr std::array<Vertex, 6> framebuffer_vertices {
   Vertex{{1.0f, -1.0f}, detail::vertex::default_color, {1.f, 0.f}},
   Vertex{{1.0f, 1.0f}, detail::vertex::default_color, {1.f, 1.f}}
 };
+
+// attachments are over-allocated by this factor when they need to grow,
+// and rounded up to alignment; so continuous window resizing does not
+// reallocate them every frame.
+static constexpr float growth_factor { 1.5f };
+static constexpr GLsizei growth_alignment { 64 };
+
+// opt-in: pass-through framebuffers can be presented with
+// glBlitNamedFramebuffer instead of drawing fullscreen quad.
+static constexpr bool default_blit_present { false };
+// opt-in: depth/stencil (and multisample color once resolved) can be
+// invalidated after unbind(); saves write-back on tilers.
+static constexpr bool default_invalidate_transient { false };
+} // namespace fre2d::detail::framebuffer
+
+enum ResizePolicy {
+  ResizeExact, // reallocate attachments every time size changes.
+  ResizeGrow // over-allocate, render into sub-viewport; shrink only if less than half is used.
+};
+
+namespace detail::framebuffer {
+static constexpr ResizePolicy default_resize_policy { ResizeExact };
 } // namespace fre2d::detail::framebuffer
 
+// texture is not owned; it must outlive framebuffer that samples it.
 struct AdditionalTexturesInfo {
   GLint sampler_id;
   const char* name;
-  Texture texture;
+  TextureHandle texture;
 };
 
 using AdditionalTextures = std::vector<AdditionalTexturesInfo>;
 
-// TODO: support multisampling for antialiasing.
 class Framebuffer {
 public:
   Framebuffer(); // then use initialize().
@@ -67,6 +96,14 @@ public:
     const char* default_vertex_shader = detail::framebuffer::default_vertex,
     const char* default_fragment_shader = detail::framebuffer::default_fragment
   ) noexcept;
+  // custom framebuffer with given attachments.
+  Framebuffer(
+    GLsizei width,
+    GLsizei height,
+    const RenderTargetDesc& desc,
+    const char* default_vertex_shader = detail::framebuffer::default_vertex,
+    const char* default_fragment_shader = detail::framebuffer::default_fragment
+  ) noexcept;
   ~Framebuffer() noexcept;
 
   // binds current framebuffer (can be default framebuffer) and resize with current size.
@@ -81,36 +118,102 @@ public:
     const AdditionalTextures& additional_textures = {}
   ) noexcept;
 
+  void initialize(
+    GLsizei width,
+    GLsizei height,
+    const RenderTargetDesc& desc,
+    const char* default_vertex_shader = detail::framebuffer::default_vertex,
+    const char* default_fragment_shader = detail::framebuffer::default_fragment,
+    const AdditionalTextures& additional_textures = {}
+  ) noexcept;
+
   // unbinds current framebuffer to default one.
+  // multisampled framebuffers are resolved into color textures here.
   void unbind() noexcept;
+
+  // copies multisample attachments into color textures;
+  // no-op if framebuffer is not multisampled.
+  void resolve() const noexcept;
   void clear() const noexcept;
 
   // to render custom framebuffer,
   // default framebuffer will just set counter to 0.
+  // pass-through framebuffers are blitted into currently bound
+  // framebuffer's viewport instead; see set_blit_present_enabled().
   void render_texture() noexcept;
+  // same as above but draws with given program instead of framebuffer's own;
+  // used for post-processing passes.
+  void render_texture(const Shader& shader) noexcept;
 
   void resize(GLsizei width, GLsizei height) noexcept; // use this everytime to resize your framebuffer
                                                        // (including default framebuffer. resize() will call glViewport directly)
 
+  // ResizeExact by default. with ResizeGrow, custom vertex shaders should
+  // multiply texture coordinates of ScreenTexture with TexCoordsScale uniform;
+  // additional textures keep their own size, sample them with unscaled ones.
+  // see detail::framebuffer::default_vertex.
+  void set_resize_policy(ResizePolicy policy) noexcept;
+  [[nodiscard]] const ResizePolicy& get_resize_policy() const noexcept;
+
+  // blit copies pixels as is; blending, vertex colors and shader are not
+  // applied. enable it only for opaque, plain presents.
+  void set_blit_present_enabled(bool enabled) noexcept;
+  [[nodiscard]] const bool& get_blit_present_enabled() const noexcept;
+  // true if framebuffer's own program only copies color buffer
+  // (default shaders, no additional textures).
+  [[nodiscard]] bool is_pass_through() const noexcept;
+
+  // enable it only if call() is last use of framebuffer in frame; next
+  // call() would start with undefined depth/stencil and multisample color.
+  void set_invalidate_transient_enabled(bool enabled) noexcept;
+  [[nodiscard]] const bool& get_invalidate_transient_enabled() const noexcept;
+
   [[nodiscard]] const GLuint& get_fbo_id() const noexcept;
+  // framebuffer that draw calls go into; differs from get_fbo_id() only if multisampled.
+  [[nodiscard]] const GLuint& get_render_fbo_id() const noexcept;
   [[nodiscard]] bool is_complete() const noexcept;
+  [[nodiscard]] const RenderTargetDesc& get_render_target_desc() const noexcept;
+  // approximate size of allocated attachments in bytes; drivers may pad them.
+  [[nodiscard]] std::size_t get_memory_usage() const noexcept;
 
   [[nodiscard]] const GLsizei& get_width() const noexcept;
   [[nodiscard]] const GLsizei& get_height() const noexcept;
 
-  [[nodiscard]] const Texture& get_color_buffer() const noexcept;
+  // allocated size of attachments, always >= get_width() and get_height().
+  [[nodiscard]] const GLsizei& get_capacity_width() const noexcept;
+  [[nodiscard]] const GLsizei& get_capacity_height() const noexcept;
+
+  [[nodiscard]] const Texture& get_color_buffer(std::size_t index = 0) const noexcept;
+  [[nodiscard]] std::size_t get_color_buffer_count() const noexcept;
+  [[nodiscard]] const std::vector<Texture>& get_color_buffers() const noexcept;
+  // wraps color attachments into AdditionalTextures, so another framebuffer's
+  // composite pass can sample all outputs of one scene pass; attachment i is
+  // bound to first_sampler_id + i with sampler_names[i].
+  [[nodiscard]] AdditionalTextures get_color_buffers_as_additional_textures(
+    GLint first_sampler_id,
+    const std::vector<const char*>& sampler_names
+  ) const noexcept;
   [[nodiscard]] const Renderbuffer& get_depth_and_stencil_renderbuffer() const noexcept;
 
   [[nodiscard]] const VertexArray& get_framebuffer_vao() const noexcept;
   [[nodiscard]] const VertexBuffer& get_framebuffer_vbo() const noexcept;
   [[nodiscard]] const Shader& get_framebuffer_shader() const noexcept;
 
+  // use already compiled program instead of compiling default shaders again;
+  // call it before initialize(). used by RenderTargetPool to share one program.
+  // pass_through tells program is compiled from default shaders, so it can be blitted.
+  // framebuffer keeps a copy, so program is shared and stays alive until
+  // last copy (or framebuffer) is gone; release() of any copy still
+  // destroys it for all.
+  void set_framebuffer_shader(const Shader& shader, bool pass_through = false) noexcept;
+
   void set_additional_textures(const AdditionalTextures& additional_textures) noexcept;
   [[nodiscard]] const AdditionalTextures& get_additional_textures() const noexcept;
 
   template<typename Callable, typename... Args>
   requires std::invocable<Callable, Args...>
   void call(Callable&& fn, Args&&... args) noexcept {
+    ProfileScope scope("Framebuffer::call");
     this->bind();
     fn(std::forward<Args>(args)...);
     this->unbind();
@@ -119,18 +222,33 @@ public:
   void clear_color(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) noexcept;
   static void clear_color_force(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) noexcept;
 private:
-  Texture _color_buffer;
+  void _reallocate_attachments(GLsizei capacity_width, GLsizei capacity_height) noexcept;
+  void _update_tex_coords_scale(const Shader& shader) const noexcept;
+  void _blit_color_buffer() const noexcept;
+  void _invalidate_transient_attachments() const noexcept;
+
+  std::vector<Texture> _color_buffers;
+  // only used if multisampled; resolved into _color_buffers.
+  std::array<Renderbuffer, detail::render_target::max_color_attachments> _msaa_color_rbs;
   Renderbuffer _depth_and_stencil_rb;
   Shader _shader;
   VertexArray _fb_vao;
   VertexBuffer _fb_vbo;
+  RenderTargetDesc _desc;
   GLuint _fbo_id;
+  GLuint _msaa_fbo_id;
   GLsizei _width;
   GLsizei _height;
+  GLsizei _capacity_width;
+  GLsizei _capacity_height;
+  ResizePolicy _resize_policy;
 
   AdditionalTextures _additional_textures;
 
   bool _first_time;
   bool _clear_called;
+  bool _pass_through;
+  bool _blit_present;
+  bool _invalidate_transient;
 };
 } // namespace fre2d
\ No newline at end of file
@@ -0,0 +1,158 @@
+// MIT License
+//
+// Copyright (c) 2025 Ferhat Geçdoğan All Rights Reserved.
+// Distributed under the terms of the MIT License.
+//
+#pragma once
+
+#include <glad/glad.h>
+#include "resource_registry.hpp"
+#include "texture.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+namespace fre2d {
+namespace detail::gpu_memory_tracker {
+static constexpr std::size_t default_budget { 0 }; // 0 = unlimited, nothing is evicted.
+static constexpr std::uint64_t default_evict_after_frames { 120 }; // ~2 seconds at 60 fps.
+} // namespace fre2d::detail::gpu_memory_tracker
+
+enum GpuMemoryClass : std::uint8_t {
+  GpuMemoryClassTexture,
+  GpuMemoryClassVertexBuffer,
+  GpuMemoryClassElementBuffer,
+  GpuMemoryClassStorageBuffer,
+  GpuMemoryClassRenderbuffer,
+  GpuMemoryClassCount
+};
+
+// bytes per pixel of sized (and unsized, as drivers store them) internal
+// formats that fre2d allocates; 4 for unknown ones. RGB8 is counted as 3,
+// though most drivers pad it to 4.
+[[nodiscard]] std::size_t get_internal_format_bytes(GLenum internal_format) noexcept;
+// bytes of first levels of mip chain; each level is half of previous one,
+// down to 1x1.
+[[nodiscard]] std::size_t get_mip_chain_bytes(
+  GLsizei width,
+  GLsizei height,
+  std::size_t bytes_per_pixel,
+  GLsizei levels = 1
+) noexcept;
+
+// estimated vram use per resource class; Texture, buffers and Renderbuffer
+// report their storage when they (re)allocate it. resources of
+// ResourceRegistry are keyed by handle value and forgotten once handle is
+// stale; renderbuffers are keyed by name and untracked by themselves.
+//
+// over budget, textures that are not bound for evict_after_frames frames
+// are evicted, least recently bound first: GL texture is deleted, handle
+// stays valid with id 0 (so it binds default texture). next bind() queues
+// file again into streaming loader; it's uploaded like load_async(). only
+// textures loaded from file with default format (Texture::load(),
+// load_async()) can be evicted, and only while streaming loader is set.
+// loading other pixels into same Texture with load_from_data() keeps its
+// file as source; use forget_stream_source() then.
+//
+// ResourceRegistry::end_frame() calls end_frame() of this one, so nothing is
+// evicted unless app calls it every frame; one per thread, like
+// ResourceRegistry.
+class GpuMemoryTracker {
+public:
+  [[nodiscard]] static GpuMemoryTracker& get() noexcept;
+
+  GpuMemoryTracker(const GpuMemoryTracker&) = delete;
+  GpuMemoryTracker& operator=(const GpuMemoryTracker&) = delete;
+
+  // replaces previously tracked size of key.
+  void track(GpuMemoryClass memory_class, std::uint32_t key, std::size_t bytes) noexcept;
+  void untrack(GpuMemoryClass memory_class, std::uint32_t key) noexcept;
+
+  // Texture::bind() calls it while is_streaming(); keeps texture resident,
+  // reloads evicted one.
+  void touch(TextureHandle handle) noexcept;
+  // streaming loader is set, and there is a budget or evicted textures to
+  // reload. frames of last use are only kept up to date while it's true;
+  // they are reset to current frame when it turns on.
+  [[nodiscard]] bool is_streaming() const noexcept {
+    return this->_loader && (this->_budget != 0 || this->_evicted_count != 0);
+  }
+
+  void set_stream_source(
+    TextureHandle handle,
+    const char* file_path,
+    bool use_nearest,
+    bool use_mipmap,
+    const Texture::WrapOptions& texture_wrap,
+    bool premultiply_alpha
+  ) noexcept;
+  void forget_stream_source(TextureHandle handle) noexcept;
+  // full sampler state (anisotropy too) that reload restores; Texture calls
+  // it whenever its sampler changes. ignored for untracked textures.
+  void set_stream_sampler(TextureHandle handle, const SamplerDesc& sampler) noexcept;
+
+  // nullptr disables eviction; set it before destroying the loader.
+  void set_streaming_loader(AsyncTextureLoader* loader) noexcept;
+  // bytes of all classes together; 0 is unlimited.
+  void set_budget(std::size_t bytes) noexcept;
+  void set_evict_after_frames(std::uint64_t frames) noexcept;
+
+  [[nodiscard]] std::size_t get_bytes(GpuMemoryClass memory_class) const noexcept;
+  // tracked bytes of one resource; 0 if it's not tracked.
+  [[nodiscard]] std::size_t get_bytes(GpuMemoryClass memory_class, std::uint32_t key) const noexcept;
+  [[nodiscard]] std::size_t get_total_bytes() const noexcept;
+  [[nodiscard]] std::size_t get_peak_total_bytes() const noexcept;
+  [[nodiscard]] std::size_t get_count(GpuMemoryClass memory_class) const noexcept;
+  // textures that are evicted and not bound since.
+  [[nodiscard]] std::size_t get_evicted_count() const noexcept;
+  // cumulative; reloads are counted when they are queued.
+  [[nodiscard]] std::size_t get_eviction_count() const noexcept;
+  [[nodiscard]] std::size_t get_reload_count() const noexcept;
+  [[nodiscard]] const std::size_t& get_budget() const noexcept;
+  [[nodiscard]] const std::uint64_t& get_evict_after_frames() const noexcept;
+  [[nodiscard]] const std::uint64_t& get_frame() const noexcept;
+private:
+  friend class ResourceRegistry;
+
+  struct StreamSource {
+    std::string file_path;
+    Texture::WrapOptions texture_wrap { Texture::WrapOptions::default_value() };
+    bool use_nearest { detail::texture::default_use_nearest };
+    bool use_mipmap { detail::texture::default_use_mipmap };
+    bool premultiply_alpha { detail::texture::default_premultiply_alpha };
+    // set after upload; load options above only give filter and wrap.
+    std::optional<SamplerDesc> sampler;
+  };
+
+  struct Record {
+    std::size_t bytes { 0 };
+    std::uint64_t last_used_frame { 0 };
+    bool has_source { false };
+    bool evicted { false };
+    StreamSource source;
+  };
+
+  GpuMemoryTracker() noexcept;
+
+  // drops stale records, evicts over budget, then advances frame.
+  void _end_frame() noexcept;
+  void _evict() noexcept;
+  void _set_bytes(GpuMemoryClass memory_class, Record& record, std::size_t bytes) noexcept;
+  // called by setters; refreshes frames of last use if streaming turned on.
+  void _on_streaming_changed(bool was_streaming) noexcept;
+
+  std::unordered_map<std::uint32_t, Record> _records[GpuMemoryClassCount];
+  std::size_t _bytes[GpuMemoryClassCount];
+  std::size_t _total_bytes;
+  std::size_t _peak_total_bytes;
+  std::size_t _evicted_count;
+  std::size_t _eviction_count;
+  std::size_t _reload_count;
+  std::size_t _budget;
+  std::uint64_t _evict_after_frames;
+  std::uint64_t _frame;
+  AsyncTextureLoader* _loader;
+};
+} // namespace fre2d
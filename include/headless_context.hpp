@@ -0,0 +1,84 @@
+// MIT License
+//
+// Copyright (c) 2025 Ferhat Geçdoğan All Rights Reserved.
+// Distributed under the terms of the MIT License.
+//
+#pragma once
+
+// only available if fre2d is built with FRE2D_BUILD_HEADLESS=ON,
+// which links EGL (and OSMesa if FRE2D_HEADLESS_OSMESA=ON).
+#ifdef FRE2D_HEADLESS
+#include <glad/glad.h>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace fre2d {
+namespace detail::headless_context {
+static constexpr GLint gl_major_version { 4 };
+static constexpr GLint gl_minor_version { 5 };
+} // namespace fre2d::detail::headless_context
+
+enum HeadlessBackend {
+  // tries EGL surfaceless, then EGL device, then OSMesa (if built with it).
+  HeadlessAuto,
+  // EGL_MESA_platform_surfaceless; works on Mesa drivers including llvmpipe,
+  // no X11/Wayland needed.
+  HeadlessEglSurfaceless,
+  // EGL_EXT_platform_device; first enumerated device (e.g. NVIDIA without display).
+  HeadlessEglDevice,
+  // legacy Mesa off-screen API; removed from recent Mesa releases.
+  HeadlessOsMesa
+};
+
+// creates OpenGL 4.5 core context without window or display server,
+// makes it current on calling thread and loads glad. there is no default
+// framebuffer to draw into; render into Framebuffer and read it back
+// with FrameReadback.
+// several threads can each own one context (they are not shared);
+// glad function pointers are global, so they are loaded only once.
+class HeadlessContext {
+public:
+  HeadlessContext() noexcept;
+  ~HeadlessContext() noexcept;
+
+  HeadlessContext(const HeadlessContext&) = delete;
+  HeadlessContext& operator=(const HeadlessContext&) = delete;
+
+  // returns false if no backend could create 4.5 core context.
+  bool initialize(HeadlessBackend backend = HeadlessAuto) noexcept;
+  // context can only be current on one thread at a time; call it
+  // after moving rendering to another thread.
+  [[nodiscard]] bool make_current() const noexcept;
+  void release() noexcept;
+
+  [[nodiscard]] const bool& is_initialized() const noexcept;
+  // actual backend after HeadlessAuto is resolved.
+  [[nodiscard]] const HeadlessBackend& get_backend() const noexcept;
+  // GL_RENDERER string, e.g. "llvmpipe (LLVM 17.0.6, 256 bits)".
+  [[nodiscard]] const char* get_renderer_name() const noexcept;
+private:
+  bool _initialize_egl(HeadlessBackend backend) noexcept;
+  bool _initialize_osmesa() noexcept;
+  bool _load_gl() noexcept;
+  // extension strings are space separated; plain strstr would match prefixes.
+  [[nodiscard]] static bool _has_extension(const char* extensions, const char* name) noexcept;
+  // EGL returns same display for same platform, so eglTerminate is only
+  // called when last context on it is released.
+  static void _retain_display(void* display) noexcept;
+  static void _release_display(void* display) noexcept;
+  [[nodiscard]] static std::unordered_map<void*, std::size_t>& _get_display_references() noexcept;
+  // recursive, since initialize() calls release() on failed backends.
+  [[nodiscard]] static std::recursive_mutex& _get_mutex() noexcept;
+
+  // kept as void* so EGL and OSMesa headers do not leak into users.
+  void* _egl_display;
+  void* _egl_context;
+  void* _egl_surface; // 1x1 pbuffer, only if driver lacks EGL_KHR_surfaceless_context.
+  void* _osmesa_context;
+  std::vector<GLubyte> _osmesa_buffer; // OSMesaMakeCurrent needs a color buffer.
+  HeadlessBackend _backend;
+  bool _initialized;
+};
+} // namespace fre2d
+#endif // FRE2D_HEADLESS
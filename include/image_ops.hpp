@@ -0,0 +1,42 @@
+// MIT License
+//
+// Copyright (c) 2025 Ferhat Geçdoğan All Rights Reserved.
+// Distributed under the terms of the MIT License.
+//
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace fre2d {
+// fixups applied to decoded images before upload; every enabled one is done
+// in the same pass over pixels.
+struct ImageOps {
+  bool flip_vertically { false }; // image files are top to bottom, OpenGL is bottom to top.
+  bool premultiply_alpha { false }; // rgb *= a; for BlendModePremultiplied. RGBA only.
+  bool swap_red_blue { false }; // RGBA <-> BGRA, RGB <-> BGR.
+};
+
+// applies ops to tightly packed 8-bit RGB (channels = 3) or RGBA (4) image.
+// destination may be source (in place), otherwise they must not overlap.
+// uses AVX2 (if compiled with it), SSE2 or NEON; scalar otherwise.
+// premultiplied channels are rounded to nearest, like c * a / 255.
+void process_image(
+  const std::uint8_t* source,
+  std::uint8_t* destination,
+  std::uint32_t width,
+  std::uint32_t height,
+  int channels,
+  const ImageOps& ops
+) noexcept;
+
+// reference implementation of process_image(); same results, no simd.
+void process_image_scalar(
+  const std::uint8_t* source,
+  std::uint8_t* destination,
+  std::uint32_t width,
+  std::uint32_t height,
+  int channels,
+  const ImageOps& ops
+) noexcept;
+} // namespace fre2d
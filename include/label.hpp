@@ -49,14 +49,17 @@ in vec2 TexCoords;
 in vec2 FragPos;
 
 /* this over gl_FragColor gives us flexibility of manipulating it easily */
-out vec4 Color;
-
+layout (location = 0) out vec4 Color;
+)"
+fre2d_default_emissive_output
+R"(
 uniform sampler2D Text;
 uniform vec4 TextColor;
 uniform bool AffectedByLight;
 )"
 fre2d_default_lighting_fragment
 fre2d_default_point_lights_blend_func
+fre2d_default_premultiply_func
 R"(
 void main() {
   vec4 sampled = vec4(1.f, 1.f, 1.f, texture(Text, TexCoords).r);
@@ -72,6 +75,11 @@ void main() {
     1.f - float(AffectedByLight)
   );
   Color *= TextColor * attr_TextColor * sampled;
+  vec4 unlit_color = TextColor * attr_TextColor * sampled;
+  EmissiveColor = vec4(unlit_color.rgb * Emissive, unlit_color.a);
+  // glyph bitmaps are coverage, not premultiplied textures.
+  Color = premultiply_output(Color, 1.f);
+  EmissiveColor = premultiply_output(EmissiveColor, 1.f);
 }
 )";
 } // namespace fer2d::detail::label
@@ -145,7 +153,8 @@ private:
     bool flip_horizontally
   ) noexcept;
 
-  Font _font;
+  // font must outlive label; its glyph textures are released with it.
+  const Font* _font { nullptr };
   VertexArray _vao;
   VertexBuffer _vbo;
   std::string _text;
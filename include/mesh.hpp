@@ -32,9 +32,10 @@ public:
   [[nodiscard]] const VertexArray& get_vao() const noexcept;
   [[nodiscard]] const VertexBuffer& get_vbo() const noexcept;
   [[nodiscard]] const ElementBuffer& get_ebo() const noexcept;
-  [[nodiscard]] const std::optional<Texture>& get_texture() const noexcept;
+  // mesh only refers to texture; keep Texture alive while mesh is drawn.
+  [[nodiscard]] const std::optional<TextureHandle>& get_texture() const noexcept;
 
-  [[nodiscard]] std::optional<Texture>& get_texture_mutable() noexcept;
+  [[nodiscard]] std::optional<TextureHandle>& get_texture_mutable() noexcept;
 
   void initialize(
     const std::vector<Vertex>& vertices,
@@ -49,6 +50,6 @@ private:
   ElementBuffer _ebo;
   std::vector<Vertex> _vertices;
   std::vector<GLuint> _indices;
-  std::optional<Texture> _texture;
+  std::optional<TextureHandle> _texture;
 };
 } // namespace fre2d
\ No newline at end of file
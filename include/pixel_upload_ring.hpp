@@ -0,0 +1,109 @@
+// MIT License
+//
+// Copyright (c) 2025 Ferhat Geçdoğan All Rights Reserved.
+// Distributed under the terms of the MIT License.
+//
+#pragma once
+
+#include "texture.hpp"
+#include <cstddef>
+#include <deque>
+#include <mutex>
+
+namespace fre2d {
+namespace detail::pixel_upload_ring {
+// enough for few 1024x1024 RGBA8 images in flight.
+static constexpr std::size_t default_capacity { 16 * 1024 * 1024 };
+// offsets are kept aligned so every row format (and SSE memcpy) is happy.
+static constexpr std::size_t allocation_alignment { 16 };
+} // namespace fre2d::detail::pixel_upload_ring
+
+// part of PixelUploadRing that pixels are written into.
+// data is nullptr if ring had no free space.
+struct UploadSpan {
+  unsigned char* data;
+  std::size_t offset;
+  std::size_t size;
+};
+
+// persistently mapped pixel-unpack buffer used as ring. allocate() hands out
+// gpu-visible memory that can be filled from any thread; upload() and
+// stream() then copy it into textures with a pbo offset instead of client
+// pointer, so driver doesn't copy synchronously. every submitted span is
+// fenced and reused once gpu is done with it; nothing waits for gpu except
+// destructor.
+//
+// for video-like updates create texture once (e.g. load_nothing()), then
+// each frame: allocate(), write pixels, stream().
+//
+// construct and destroy with context current. allocate() and release() are
+// thread-safe, everything else belongs to render thread.
+class PixelUploadRing {
+public:
+  explicit PixelUploadRing(std::size_t capacity = detail::pixel_upload_ring::default_capacity) noexcept;
+  ~PixelUploadRing() noexcept;
+
+  PixelUploadRing(const PixelUploadRing&) = delete;
+  PixelUploadRing& operator=(const PixelUploadRing&) = delete;
+
+  // never blocks; returns span with data = nullptr if there is not enough
+  // room, caller should retry next frame or fall back to client memory.
+  [[nodiscard]] UploadSpan allocate(std::size_t size) noexcept;
+  // gives span back without uploading (e.g. decoding failed).
+  void release(const UploadSpan& span) noexcept;
+
+  // creates immutable storage for texture and fills it from span, like
+  // Texture::load_from_data().
+  void upload(
+    const UploadSpan& span,
+    Texture& texture,
+    GLsizei width,
+    GLsizei height,
+    bool use_nearest = detail::texture::default_use_nearest,
+    bool use_mipmap = detail::texture::default_use_mipmap,
+    const Texture::WrapOptions& texture_wrap = Texture::WrapOptions::default_value(),
+    int channels = 4
+  ) noexcept;
+
+  // overwrites region of already allocated texture.
+  void stream(
+    const UploadSpan& span,
+    const Texture& texture,
+    GLsizei width,
+    GLsizei height,
+    int channels = 4,
+    GLint x_offset = 0,
+    GLint y_offset = 0
+  ) noexcept;
+
+  // polls fences of submitted spans without waiting; space of finished
+  // ones is reused by allocate(). call once per frame on render thread.
+  void reclaim() noexcept;
+
+  [[nodiscard]] bool is_mapped() const noexcept;
+  [[nodiscard]] const std::size_t& get_capacity() const noexcept;
+  // bytes that are allocated or in flight, including wasted tail on wrap.
+  [[nodiscard]] std::size_t get_used_bytes() const noexcept;
+private:
+  struct Region {
+    std::size_t offset;
+    std::size_t bytes; // size + skipped tail of buffer, if it wrapped.
+    GLsync fence; // nullptr after it is signaled (or if never uploaded).
+    bool submitted;
+  };
+
+  // marks region that starts at offset as submitted; fence may be nullptr.
+  void _submit(std::size_t offset, GLsync fence) noexcept;
+  // pops finished regions from front; no gl calls, so any thread can do it.
+  void _pop_finished_locked() noexcept;
+
+  GLuint _buffer_id;
+  unsigned char* _mapped;
+  std::size_t _capacity;
+  std::size_t _head;
+  std::size_t _used;
+  // in allocation order; only front can be reused.
+  std::deque<Region> _regions;
+  mutable std::mutex _mutex;
+};
+} // namespace fre2d
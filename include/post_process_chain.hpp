@@ -0,0 +1,92 @@
+// MIT License
+//
+// Copyright (c) 2025 Ferhat Geçdoğan All Rights Reserved.
+// Distributed under the terms of the MIT License.
+//
+#pragma once
+
+#include "render_target_pool.hpp"
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace fre2d {
+namespace detail::post_process_chain {
+// per-pixel pass sources must define this function, like:
+// vec4 fre2d_effect(vec4 color, vec2 tex_coords) { return color * Tint; }
+static constexpr auto effect_function_name = "fre2d_effect";
+
+static constexpr auto per_pixel_header =
+R"(#version 450 core
+in vec2 TexCoords;
+in vec4 Color;
+out vec4 FragColor;
+uniform sampler2D ScreenTexture;
+)";
+
+static constexpr bool default_fusion_enabled { true };
+} // namespace fre2d::detail::post_process_chain
+
+enum PostProcessPassKind {
+  // only transforms color of current pixel; adjacent ones are fused into one program.
+  // source is a GLSL snippet that defines fre2d_effect() and its uniforms.
+  PassPerPixel,
+  // samples neighbors (blur, distortion etc.); source is complete fragment shader
+  // that reads ScreenTexture with TexCoords like detail::framebuffer::default_fragment.
+  PassNeighborhood
+};
+
+struct PostProcessPass {
+  PostProcessPassKind kind;
+  std::string source;
+  // optional; called before drawing the program that contains this pass.
+  std::function<void(const Shader&)> set_uniforms;
+};
+
+// runs fullscreen passes through two ping-pong targets taken from RenderTargetPool.
+// fused passes share one program; a pass that declares uniform with same name
+// as an earlier one in the run starts a new program instead. helper functions
+// other than fre2d_effect are not renamed, so their names must not collide.
+class PostProcessChain {
+public:
+  explicit PostProcessChain(RenderTargetPool& pool) noexcept;
+
+  void push_pass(const PostProcessPass& pass) noexcept;
+  void clear() noexcept;
+
+  void set_fusion_enabled(bool fusion_enabled) noexcept;
+  // format of intermediate targets; depth/stencil is not needed for fullscreen passes.
+  void set_target_desc(const RenderTargetDesc& desc) noexcept;
+
+  // generates and compiles programs; apply() calls it if passes have changed.
+  void compile() noexcept;
+
+  // reads input's first color buffer; last pass is drawn into output,
+  // or into default framebuffer if output is nullptr. without passes, input
+  // is copied there as is.
+  void apply(Framebuffer& input, Framebuffer* output = nullptr) noexcept;
+
+  [[nodiscard]] const std::vector<PostProcessPass>& get_passes() const noexcept;
+  // fullscreen draws per apply(); less than pass count if some are fused,
+  // 1 (copy) if there are no passes.
+  [[nodiscard]] std::size_t get_program_count() const noexcept;
+  [[nodiscard]] const bool& get_fusion_enabled() const noexcept;
+private:
+  struct Stage {
+    Shader shader;
+    std::vector<std::size_t> pass_indices;
+  };
+
+  [[nodiscard]] static std::string _generate_fused_source(
+    const std::vector<PostProcessPass>& passes,
+    const std::vector<std::size_t>& pass_indices
+  ) noexcept;
+
+  RenderTargetPool& _pool;
+  RenderTargetDesc _target_desc;
+  std::vector<PostProcessPass> _passes;
+  std::vector<Stage> _stages;
+  bool _fusion_enabled;
+  bool _dirty;
+};
+} // namespace fre2d
@@ -0,0 +1,143 @@
+// MIT License
+//
+// Copyright (c) 2025 Ferhat Geçdoğan All Rights Reserved.
+// Distributed under the terms of the MIT License.
+//
+#pragma once
+
+#include <glad/glad.h>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <vector>
+
+namespace fre2d {
+namespace detail::profiler {
+static constexpr std::size_t default_history { 240 }; // frames kept for get_frame().
+// frames to wait before timestamp queries are read; gpu is usually 1-2
+// frames behind, so results are there by then and reading never stalls.
+static constexpr std::size_t default_latency { 3 };
+static constexpr std::uint32_t no_scope { std::numeric_limits<std::uint32_t>::max() };
+// scope id is generation << scope_index_bits | index into records of frame;
+// generation changes in end_frame() and clear(), so scopes left open across
+// them don't close records of later frames.
+static constexpr std::uint32_t scope_index_bits { 20 };
+static constexpr std::uint32_t scope_index_mask { (1u << scope_index_bits) - 1 };
+static constexpr std::uint32_t scope_generation_mask { (1u << (32 - scope_index_bits)) - 1 };
+} // namespace fre2d::detail::profiler
+
+// scopes with same name and depth in a frame are summed up.
+struct ProfileScopeResult {
+  const char* name;
+  std::uint32_t depth; // 0 for scopes that are not inside another one.
+  std::uint32_t calls;
+  double cpu_ms;
+  double gpu_ms; // 0 for cpu-only scopes.
+};
+
+struct ProfileFrame {
+  std::uint64_t frame_index;
+  double cpu_ms; // between end_frame() calls.
+  double gpu_ms; // sum of top-level gpu scopes; what gpu spent on our passes.
+  std::vector<ProfileScopeResult> scopes; // in order of first call.
+};
+
+// records cpu time (steady_clock) and gpu time (GL_TIMESTAMP queries) of
+// ProfileScope's. queries are read back latency frames later, once they
+// are available; so no call waits for gpu. finished frames are kept in
+// ring buffer of history frames.
+//
+// cpu_ms close to frame time and gpu_ms well below it is cpu-bound frame;
+// gpu_ms close to it is gpu-bound.
+//
+// disabled by default, scopes cost one branch then. one per thread (like
+// SamplerCache), since queries belong to context that is current on it.
+class Profiler {
+public:
+  [[nodiscard]] static Profiler& get() noexcept;
+
+  Profiler(const Profiler&) = delete;
+  Profiler& operator=(const Profiler&) = delete;
+
+  // gpu_timing = false records cpu time only (e.g. no context yet).
+  void set_enabled(bool enabled, bool gpu_timing = true) noexcept;
+  // drops history; it's resized to fit.
+  void set_history(std::size_t history) noexcept;
+
+  // call once per frame, after last pass (e.g. after swapping buffers).
+  // closes current frame and reads back frames whose queries are done.
+  void end_frame() noexcept;
+  // deletes every query and drops pending frames; call it before destroying
+  // context of this thread.
+  void clear() noexcept;
+
+  // frames_ago = 0 is latest finished frame; nullptr if there is none.
+  [[nodiscard]] const ProfileFrame* get_frame(std::size_t frames_ago = 0) const noexcept;
+  // finished frames in history.
+  [[nodiscard]] std::size_t get_frame_count() const noexcept;
+  // frames waiting for their queries.
+  [[nodiscard]] std::size_t get_pending_count() const noexcept;
+  [[nodiscard]] const bool& is_enabled() const noexcept;
+  [[nodiscard]] const bool& is_gpu_timing() const noexcept;
+
+  // used by ProfileScope; returns detail::profiler::no_scope if disabled.
+  [[nodiscard]] std::uint32_t begin_scope(const char* name, bool gpu) noexcept;
+  void end_scope(std::uint32_t scope) noexcept;
+private:
+  struct ScopeRecord {
+    const char* name;
+    std::uint32_t depth;
+    std::int64_t cpu_begin_ns;
+    std::int64_t cpu_end_ns;
+    GLuint begin_query; // 0 for cpu-only scopes.
+    GLuint end_query;
+  };
+
+  struct PendingFrame {
+    std::uint64_t frame_index;
+    double cpu_ms;
+    std::vector<ScopeRecord> records;
+  };
+
+  Profiler() noexcept;
+
+  [[nodiscard]] GLuint _acquire_query() noexcept;
+  // false if last query of frame is not available yet.
+  [[nodiscard]] bool _is_available(const PendingFrame& frame) const noexcept;
+  void _resolve(PendingFrame& frame) noexcept;
+
+  std::vector<ScopeRecord> _records; // of current frame.
+  std::deque<PendingFrame> _pending;
+  std::vector<std::vector<ScopeRecord>> _spare_records; // reused, no allocations per frame.
+  std::vector<GLuint> _free_queries;
+  std::vector<ProfileFrame> _history;
+  std::size_t _history_head; // next slot to write.
+  std::size_t _history_count;
+  std::uint64_t _frame_count;
+  std::int64_t _frame_begin_ns;
+  std::uint32_t _depth;
+  std::uint32_t _scope_generation;
+  bool _enabled;
+  bool _gpu_timing;
+};
+
+// records time from construction to destruction into Profiler::get(); use
+// string literals (or names that outlive history) for name.
+class ProfileScope {
+public:
+  explicit ProfileScope(const char* name, bool gpu = true) noexcept
+    : _scope{Profiler::get().begin_scope(name, gpu)} {}
+
+  ~ProfileScope() noexcept {
+    if(this->_scope != detail::profiler::no_scope) {
+      Profiler::get().end_scope(this->_scope);
+    }
+  }
+
+  ProfileScope(const ProfileScope&) = delete;
+  ProfileScope& operator=(const ProfileScope&) = delete;
+private:
+  std::uint32_t _scope;
+};
+} // namespace fre2d
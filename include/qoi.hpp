@@ -0,0 +1,83 @@
+// MIT License
+//
+// Copyright (c) 2025 Ferhat Geçdoğan All Rights Reserved.
+// Distributed under the terms of the MIT License.
+//
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// "Quite OK Image" format (https://qoiformat.org/qoi-specification.pdf);
+// lossless like PNG, but encodes and decodes several times faster
+// since there is no entropy coding.
+namespace fre2d {
+namespace detail::qoi {
+static constexpr std::array<std::uint8_t, 4> magic { 'q', 'o', 'i', 'f' };
+static constexpr std::size_t header_size { 14 };
+static constexpr std::array<std::uint8_t, 8> end_marker { 0, 0, 0, 0, 0, 0, 0, 1 };
+
+static constexpr std::uint8_t op_index { 0x00 }; // 00xxxxxx
+static constexpr std::uint8_t op_diff { 0x40 }; // 01xxxxxx
+static constexpr std::uint8_t op_luma { 0x80 }; // 10xxxxxx
+static constexpr std::uint8_t op_run { 0xc0 }; // 11xxxxxx
+static constexpr std::uint8_t op_rgb { 0xfe };
+static constexpr std::uint8_t op_rgba { 0xff };
+static constexpr std::uint8_t op_mask { 0xc0 };
+static constexpr std::uint8_t max_run { 62 }; // 63 and 64 would collide with op_rgb and op_rgba.
+
+// 2 GiB of rgba pixels; same limit as reference implementation.
+static constexpr std::uint32_t max_pixels { 400'000'000 };
+
+[[nodiscard]] static constexpr std::size_t hash(std::uint8_t r, std::uint8_t g, std::uint8_t b, std::uint8_t a) noexcept {
+  return (r * 3u + g * 5u + b * 7u + a * 11u) % 64u;
+}
+} // namespace fre2d::detail::qoi
+
+enum QoiColorspace : std::uint8_t {
+  QoiSrgb = 0, // sRGB with linear alpha
+  QoiLinear = 1 // all channels linear
+};
+
+// pixels are tightly packed, channels is 3 (RGB) or 4 (RGBA).
+// flip_vertically writes rows bottom to top, so OpenGL readbacks
+// (see FrameReadback) can be encoded without extra copy.
+// returns empty vector on invalid arguments.
+[[nodiscard]] std::vector<std::uint8_t> encode_qoi(
+  const std::uint8_t* pixels,
+  std::uint32_t width,
+  std::uint32_t height,
+  std::uint8_t channels,
+  bool flip_vertically = false,
+  QoiColorspace colorspace = QoiSrgb
+) noexcept;
+
+struct QoiHeader {
+  std::uint32_t width;
+  std::uint32_t height;
+  std::uint8_t channels; // of encoded image; decode_qoi() can output either.
+  QoiColorspace colorspace;
+};
+
+[[nodiscard]] bool is_qoi(const std::uint8_t* data, std::size_t size) noexcept;
+// returns false (and logs) if header is invalid.
+[[nodiscard]] bool read_qoi_header(const std::uint8_t* data, std::size_t size, QoiHeader& header) noexcept;
+
+// decodes straight into destination, which must hold width * height *
+// channels bytes (e.g. UploadSpan of PixelUploadRing); channels is 3 or 4
+// regardless of file. flip_vertically writes rows bottom to top, like
+// Texture::load() expects. returns false (and logs) on invalid data.
+[[nodiscard]] bool decode_qoi(
+  const std::uint8_t* data,
+  std::size_t size,
+  std::uint8_t* destination,
+  std::uint8_t channels,
+  bool flip_vertically = false
+) noexcept;
+
+// reads whole file into bytes if it starts with qoi magic; returns false
+// otherwise without logging, so caller can try other decoders.
+[[nodiscard]] bool read_qoi_file(const char* file_path, std::vector<std::uint8_t>& bytes) noexcept;
+} // namespace fre2d
@@ -6,6 +6,7 @@
 #pragma once
 
 #include "drawable.hpp"
+#include "texture_atlas.hpp"
 #include <memory>
 #include <array>
 
@@ -36,6 +37,19 @@ public:
     bool flip_horizontally = detail::drawable::default_flip_horizontally
   ) noexcept;
 
+  // sprite packed into TextureAtlas; draws region of its page.
+  explicit Rectangle(
+    GLsizei width,
+    GLsizei height,
+    const glm::vec2& position,
+    const glm::vec4& color,
+    const TextureAtlas& atlas,
+    const AtlasRegion& region,
+    GLfloat rotation_rads = detail::drawable::default_rotation_radians,
+    bool flip_vertically = detail::drawable::default_flip_vertically,
+    bool flip_horizontally = detail::drawable::default_flip_horizontally
+  ) noexcept;
+
   ~Rectangle() override = default;
 
   void initialize_rectangle(
@@ -60,6 +74,18 @@ public:
     bool flip_horizontally = detail::drawable::default_flip_horizontally
   ) noexcept;
 
+  void initialize_rectangle(
+    GLsizei width,
+    GLsizei height,
+    const glm::vec2& position,
+    const glm::vec4& color,
+    const TextureAtlas& atlas,
+    const AtlasRegion& region,
+    GLfloat rotation_rads = detail::drawable::default_rotation_radians,
+    bool flip_vertically = detail::drawable::default_flip_vertically,
+    bool flip_horizontally = detail::drawable::default_flip_horizontally
+  ) noexcept;
+
   void draw(const Shader &shader, const std::unique_ptr<Renderer>& rnd) noexcept override;
   void draw(
       const Shader &shader,
@@ -67,6 +93,20 @@ public:
       const std::unique_ptr<LightManager>& lm
   ) noexcept override;
 private:
+  void _initialize_rectangle(
+    GLsizei width,
+    GLsizei height,
+    const glm::vec2& position,
+    const std::array<glm::vec4, 4>& color,
+    const Texture& texture,
+    const glm::vec2& uv_min,
+    const glm::vec2& uv_max,
+    GLfloat layer,
+    GLfloat rotation_rads,
+    bool flip_vertically,
+    bool flip_horizontally
+  ) noexcept;
+
   std::vector<Vertex> _vertices;
 };
 } // namespace fre2d
\ No newline at end of file
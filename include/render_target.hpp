@@ -0,0 +1,84 @@
+// MIT License
+//
+// Copyright (c) 2025 Ferhat Geçdoğan All Rights Reserved.
+// Distributed under the terms of the MIT License.
+//
+#pragma once
+
+#include <glad/glad.h>
+#include <vector>
+
+namespace fre2d {
+namespace detail::render_target {
+// GL 4.5 guarantees at least 8 color attachments and draw buffers.
+static constexpr std::size_t max_color_attachments { 8 };
+static constexpr GLsizei default_samples { 1 };
+} // namespace fre2d::detail::render_target
+
+enum ColorFormat : GLenum {
+  ColorRgba8 = GL_RGBA8,
+  ColorRgba16f = GL_RGBA16F, // hdr, bloom etc.
+  ColorR8 = GL_R8, // masks
+  ColorRgb10A2 = GL_RGB10_A2
+};
+
+enum DepthStencilFormat : GLenum {
+  DepthStencilNone = GL_NONE, // most of 2D scenes do not need them at all.
+  Depth24Stencil8 = GL_DEPTH24_STENCIL8,
+  Depth32fStencil8 = GL_DEPTH32F_STENCIL8,
+  Depth24 = GL_DEPTH_COMPONENT24,
+  Stencil8 = GL_STENCIL_INDEX8
+};
+
+// describes attachments of a Framebuffer.
+// * every color format creates one color attachment (GL_COLOR_ATTACHMENT0 + index),
+//   more than one means MRT, so fragment shader can write into layout(location = index).
+// * samples > 1 renders into multisample renderbuffers; they are resolved
+//   into color textures automatically when framebuffer is unbound.
+struct RenderTargetDesc {
+  std::vector<ColorFormat> color_formats { ColorRgba8 };
+  DepthStencilFormat depth_stencil { Depth24Stencil8 };
+  GLsizei samples { detail::render_target::default_samples };
+
+  [[nodiscard]]
+  static RenderTargetDesc default_value() noexcept {
+    return RenderTargetDesc();
+  }
+
+  friend bool operator==(const RenderTargetDesc& lhs, const RenderTargetDesc& rhs) noexcept = default;
+};
+
+namespace detail::render_target {
+// pixel format that used while allocating mutable storage.
+[[nodiscard]] static constexpr GLenum get_pixel_format(ColorFormat format) noexcept {
+  return format == ColorR8 ? GL_RED : GL_RGBA;
+}
+
+[[nodiscard]] static constexpr std::size_t get_bytes_per_pixel(ColorFormat format) noexcept {
+  switch(format) {
+    case ColorRgba16f: { return 8; }
+    case ColorR8: { return 1; }
+    default: { return 4; }
+  }
+}
+
+[[nodiscard]] static constexpr std::size_t get_bytes_per_pixel(DepthStencilFormat format) noexcept {
+  switch(format) {
+    case DepthStencilNone: { return 0; }
+    case Stencil8: { return 1; }
+    case Depth24: { return 3; }
+    case Depth32fStencil8: { return 5; }
+    default: { return 4; }
+  }
+}
+
+[[nodiscard]] static constexpr GLenum get_attachment_point(DepthStencilFormat format) noexcept {
+  switch(format) {
+    case Depth24: { return GL_DEPTH_ATTACHMENT; }
+    case Stencil8: { return GL_STENCIL_ATTACHMENT; }
+    case DepthStencilNone: { return GL_NONE; }
+    default: { return GL_DEPTH_STENCIL_ATTACHMENT; }
+  }
+}
+} // namespace fre2d::detail::render_target
+} // namespace fre2d
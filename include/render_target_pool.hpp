@@ -0,0 +1,61 @@
+// MIT License
+//
+// Copyright (c) 2025 Ferhat Geçdoğan All Rights Reserved.
+// Distributed under the terms of the MIT License.
+//
+#pragma once
+
+#include "framebuffer.hpp"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace fre2d {
+namespace detail::render_target_pool {
+static constexpr std::uint32_t default_max_unused_frames { 3 };
+} // namespace fre2d::detail::render_target_pool
+
+// hands out transient Framebuffers (post-processing, offscreen passes etc.)
+// and recycles them. acquire() at the start of pass, release() when its color
+// buffers are no longer sampled; then another pass in the same or next frames
+// can reuse same allocation. call end_frame() once per frame, so targets that
+// are not used for max_unused_frames frames are deleted.
+class RenderTargetPool {
+public:
+  explicit RenderTargetPool(std::uint32_t max_unused_frames = detail::render_target_pool::default_max_unused_frames) noexcept;
+  ~RenderTargetPool() noexcept = default;
+
+  // returned reference stays valid till it's released and evicted.
+  [[nodiscard]] Framebuffer& acquire(
+    GLsizei width,
+    GLsizei height,
+    const RenderTargetDesc& desc = RenderTargetDesc::default_value()
+  ) noexcept;
+  void release(const Framebuffer& fb) noexcept;
+
+  void end_frame() noexcept;
+  // deletes every target that is not in use.
+  void clear() noexcept;
+
+  void set_max_unused_frames(std::uint32_t max_unused_frames) noexcept;
+
+  [[nodiscard]] const std::uint32_t& get_max_unused_frames() const noexcept;
+  [[nodiscard]] const std::uint64_t& get_frame_index() const noexcept;
+  [[nodiscard]] std::size_t get_target_count() const noexcept;
+  [[nodiscard]] std::size_t get_in_use_count() const noexcept;
+  // sum of Framebuffer::get_memory_usage() of every pooled target.
+  [[nodiscard]] std::size_t get_memory_usage() const noexcept;
+private:
+  struct Entry {
+    std::unique_ptr<Framebuffer> framebuffer;
+    std::uint64_t last_used_frame;
+    bool in_use;
+  };
+
+  std::vector<Entry> _entries;
+  // every pooled target uses the same composite program.
+  Shader _shader;
+  std::uint64_t _frame_index;
+  std::uint32_t _max_unused_frames;
+};
+} // namespace fre2d
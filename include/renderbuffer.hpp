@@ -11,32 +11,42 @@ namespace fre2d {
 namespace detail::renderbuffer {
 static constexpr GLuint default_internal_format { GL_DEPTH24_STENCIL8 };
 static constexpr GLuint default_attachment { GL_DEPTH_STENCIL_ATTACHMENT };
+static constexpr GLsizei default_samples { 1 };
 } // namespace fre2d::detail::renderbuffer
 
 class Framebuffer;
 class Renderbuffer {
 public:
-  Renderbuffer() = default; // then use initialize()
+  Renderbuffer() noexcept; // then use initialize()
   explicit Renderbuffer(GLsizei width,
                         GLsizei height,
                         GLuint internal_format = detail::renderbuffer::default_internal_format,
-                        GLuint attachment = detail::renderbuffer::default_attachment) noexcept;
+                        GLuint attachment = detail::renderbuffer::default_attachment,
+                        GLsizei samples = detail::renderbuffer::default_samples) noexcept;
   ~Renderbuffer() noexcept;
 
+  // samples > 1 allocates multisample storage.
   void initialize(GLsizei width,
                   GLsizei height,
                   GLuint internal_format = detail::renderbuffer::default_internal_format,
-                  GLuint attachment = detail::renderbuffer::default_attachment) noexcept;
+                  GLuint attachment = detail::renderbuffer::default_attachment,
+                  GLsizei samples = detail::renderbuffer::default_samples) noexcept;
+  // reallocates storage of the same renderbuffer object.
+  void resize(GLsizei width, GLsizei height) noexcept;
   void bind() const noexcept;
   void unbind() const noexcept;
   void attach(const Framebuffer& fb, GLuint attachment = detail::renderbuffer::default_attachment) const noexcept;
 
   [[nodiscard]] const GLuint& get_rbo_id() const noexcept;
+  [[nodiscard]] const GLsizei& get_samples() const noexcept;
 private:
+  void _allocate_storage() const noexcept;
+
   GLuint _rbo_id;
   GLsizei _width;
   GLsizei _height;
   GLuint _internal_format;
   GLuint _attachment;
+  GLsizei _samples;
 };
 } // namespace fre2d
\ No newline at end of file
@@ -5,6 +5,7 @@
 //
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include "camera.hpp"
 #include "framebuffer.hpp"
@@ -20,6 +21,24 @@ static constexpr GLsizei default_height { 600 };
 static constexpr auto default_tests { GL_DEPTH_TEST | GL_STENCIL_TEST };
 } // namespace fre2d::detail::renderer
 
+enum BlendMode : std::uint8_t {
+  BlendModeNone,
+  BlendModeAlpha, // straight alpha; GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA.
+  // GL_ONE, GL_ONE_MINUS_SRC_ALPHA; load textures with premultiply_alpha = true.
+  // no dark fringes on filtered edges, and texels with alpha = 0 but rgb > 0
+  // are added, so additive and alpha sprites can be drawn without switching.
+  BlendModePremultiplied,
+  BlendModeAdditive // GL_SRC_ALPHA, GL_ONE.
+};
+
+namespace detail::renderer {
+static constexpr BlendMode default_blend_mode { BlendModeAlpha };
+} // namespace fre2d::detail::renderer
+
+// Renderer does not own frame loop; call ResourceRegistry::get().end_frame()
+// once per frame after last draw (after Framebuffer::render_texture(),
+// before swapping buffers). GpuMemoryTracker eviction and batched deletion
+// of released GL objects run only in it.
 class Renderer {
 public:
   Renderer() noexcept;
@@ -41,7 +60,17 @@ public:
   [[nodiscard]] const GLsizei& get_height() const noexcept;
 
   [[nodiscard]] const bool& is_initialized() const noexcept;
+
+  // sets blend state of current context; drawables tell default shaders
+  // (PremultipliedAlpha uniform) whether to output premultiplied color.
+  // static since blend state belongs to context, not to Renderer; tracked
+  // per thread, as each thread has its own current context.
+  static void set_blend_mode(BlendMode blend_mode) noexcept;
+  [[nodiscard]] static const BlendMode& get_blend_mode() noexcept;
 private:
+  // mirrors what set_blend_mode() applied; nothing is applied until it's called.
+  static inline thread_local BlendMode _blend_mode { detail::renderer::default_blend_mode };
+
   std::unique_ptr<Framebuffer> _framebuffer;
   std::unique_ptr<Camera> _camera;
   std::unique_ptr<LightManager> _lm;
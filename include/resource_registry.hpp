@@ -0,0 +1,208 @@
+// MIT License
+//
+// Copyright (c) 2025 Ferhat Geçdoğan All Rights Reserved.
+// Distributed under the terms of the MIT License.
+//
+#pragma once
+
+#include <glad/glad.h>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace fre2d {
+namespace detail::resource_registry {
+// handle is generation << index_bits | index; so ~1M live resources per type
+// and 4095 reuses of a slot before a stale handle could match again.
+static constexpr std::uint32_t index_bits { 20 };
+static constexpr std::uint32_t index_mask { (1u << index_bits) - 1 };
+static constexpr std::uint32_t max_generation { (1u << (32 - index_bits)) - 1 };
+} // namespace fre2d::detail::resource_registry
+
+enum ResourceType : std::uint8_t {
+  ResourceTypeTexture,
+  ResourceTypeShader, // program; stage objects die with it.
+  ResourceTypeBuffer,
+  ResourceTypeCount
+};
+
+// 32-bit generational handle; trivially copyable, 0 is null. handles of
+// destroyed resources never match again (until generation wraps), so
+// lookups give 0 instead of a reused or deleted GL name.
+template<ResourceType Type>
+struct ResourceHandle {
+  std::uint32_t value { 0 };
+
+  [[nodiscard]] constexpr std::uint32_t get_index() const noexcept {
+    return this->value & detail::resource_registry::index_mask;
+  }
+
+  [[nodiscard]] constexpr std::uint32_t get_generation() const noexcept {
+    return this->value >> detail::resource_registry::index_bits;
+  }
+
+  [[nodiscard]] constexpr bool is_null() const noexcept {
+    return this->value == 0;
+  }
+
+  friend constexpr bool operator==(const ResourceHandle& lhs, const ResourceHandle& rhs) noexcept = default;
+};
+
+using TextureHandle = ResourceHandle<ResourceTypeTexture>;
+using ShaderHandle = ResourceHandle<ResourceTypeShader>;
+using BufferHandle = ResourceHandle<ResourceTypeBuffer>;
+
+// owns GL names of textures, shaders and buffers in dense per-type slot
+// arrays. Texture and Shader own a reference to their slot; copies share
+// it and last one that goes out of scope destroys it. handles themselves
+// do not own anything (like ones in Mesh and AdditionalTexturesInfo).
+// buffer classes are plain handles and destroy explicitly.
+// destroy() invalidates handle at once. until end_frame() is called for
+// the first time, GL objects are deleted at once too; apps that never call
+// it behave like before. after that, they are deleted (in one call per
+// type) and slots are reused only in end_frame(); so handles recorded
+// earlier in the frame never alias new resources.
+//
+// one per thread (like SamplerCache), since names belong to context that is
+// current on that thread.
+class ResourceRegistry {
+public:
+  [[nodiscard]] static ResourceRegistry& get() noexcept;
+
+  ResourceRegistry(const ResourceRegistry&) = delete;
+  ResourceRegistry& operator=(const ResourceRegistry&) = delete;
+
+  // takes ownership of name; it can be 0 and set later with set_name().
+  // slot starts with one reference. returns null handle if there are no
+  // free slots.
+  template<ResourceType Type>
+  [[nodiscard]] ResourceHandle<Type> create(GLuint name = 0) noexcept {
+    return ResourceHandle<Type> { this->_create(Type, name) };
+  }
+
+  // stale and null handles are ignored, so every copy may call it.
+  template<ResourceType Type>
+  void destroy(ResourceHandle<Type> handle) noexcept {
+    this->_destroy(Type, handle.value, true);
+  }
+
+  // owning copies (Texture, Shader) call them; destroy() at zero references.
+  // stale and null handles are ignored.
+  template<ResourceType Type>
+  void add_ref(ResourceHandle<Type> handle) noexcept {
+    if(auto* slot = this->_find(Type, handle.value)) {
+      ++slot->ref_count;
+    }
+  }
+
+  template<ResourceType Type>
+  void remove_ref(ResourceHandle<Type> handle) noexcept {
+    auto* slot = this->_find(Type, handle.value);
+    if(slot && --slot->ref_count == 0) {
+      this->_destroy(Type, handle.value, true);
+    }
+  }
+
+  // frees slot but leaves GL object alive; returns its name (0 if stale).
+  template<ResourceType Type>
+  GLuint detach(ResourceHandle<Type> handle) noexcept {
+    return this->_destroy(Type, handle.value, false);
+  }
+
+  [[nodiscard]] bool is_valid(auto handle) const noexcept {
+    return this->_find(this->_get_type(handle), handle.value) != nullptr;
+  }
+
+  // 0 for stale handles.
+  [[nodiscard]] GLuint get_name(auto handle) const noexcept {
+    const auto* slot = this->_find(this->_get_type(handle), handle.value);
+    return slot ? slot->name : 0;
+  }
+
+  // replaces GL object behind handle for every copy (e.g. resized or
+  // uploaded later). previous name is deleted like destroyed ones; so is
+  // name, if handle is stale.
+  template<ResourceType Type>
+  void set_name(ResourceHandle<Type> handle, GLuint name) noexcept {
+    this->_set_name(Type, handle.value, name);
+  }
+
+  // set_name() if handle is valid, otherwise handle becomes new one of name;
+  // what (re)loading functions of Texture, Shader and buffers do.
+  template<ResourceType Type>
+  void assign(ResourceHandle<Type>& handle, GLuint name) noexcept {
+    if(this->is_valid(handle)) {
+      this->set_name(handle, name);
+    } else {
+      handle = this->create<Type>(name);
+    }
+  }
+
+  // vertex and fragment stage objects kept until program is finalized;
+  // deleted with program if it's destroyed before that.
+  void set_shader_stages(ShaderHandle handle, GLuint vertex_id, GLuint fragment_id) noexcept;
+  [[nodiscard]] std::pair<GLuint, GLuint> get_shader_stages(ShaderHandle handle) const noexcept;
+
+  // sampler object (see SamplerCache) bound with texture; 0 leaves its own
+  // parameters in effect. kept in slot, so bind() through handle uses it too.
+  void set_texture_sampler(TextureHandle handle, GLuint sampler_id) noexcept;
+  [[nodiscard]] GLuint get_texture_sampler(TextureHandle handle) const noexcept;
+
+  // call once per frame, after last draw that may use destroyed resources
+  // (e.g. after Framebuffer::render_texture(), before swapping buffers).
+  // updates GpuMemoryTracker (and evicts textures over its budget) too;
+  // eviction never runs without it. first call turns on deferred deletion,
+  // so once it's called it must be called every frame.
+  void end_frame() noexcept;
+  // deletes every resource, live or not, and invalidates all handles; call
+  // it before destroying context of this thread. nothing is deleted on
+  // thread exit, context is usually gone by then.
+  void clear() noexcept;
+
+  [[nodiscard]] std::size_t get_live_count(ResourceType type) const noexcept;
+  // destroyed (or replaced) names waiting for end_frame().
+  [[nodiscard]] std::size_t get_pending_count(ResourceType type) const noexcept;
+  // true once end_frame() is called on this thread.
+  [[nodiscard]] const bool& is_deferred() const noexcept;
+private:
+  struct Slot {
+    GLuint name;
+    GLuint vertex_id; // shader stages; 0 otherwise.
+    GLuint fragment_id;
+    GLuint sampler_id; // textures; 0 otherwise.
+    std::uint32_t ref_count;
+    std::uint32_t generation;
+    bool live;
+  };
+
+  struct Pool {
+    std::vector<Slot> slots;
+    std::vector<std::uint32_t> free_indices;
+    std::vector<std::uint32_t> destroyed_indices; // free after end_frame().
+    std::vector<GLuint> destroyed_names;
+    std::vector<GLuint> destroyed_stages;
+    std::size_t live_count { 0 };
+  };
+
+  ResourceRegistry() noexcept = default;
+
+  template<ResourceType Type>
+  [[nodiscard]] static constexpr ResourceType _get_type(ResourceHandle<Type>) noexcept {
+    return Type;
+  }
+
+  [[nodiscard]] std::uint32_t _create(ResourceType type, GLuint name) noexcept;
+  GLuint _destroy(ResourceType type, std::uint32_t value, bool delete_name) noexcept;
+  void _set_name(ResourceType type, std::uint32_t value, GLuint name) noexcept;
+  [[nodiscard]] Slot* _find(ResourceType type, std::uint32_t value) noexcept;
+  [[nodiscard]] const Slot* _find(ResourceType type, std::uint32_t value) const noexcept;
+  // deletes pending names of type and frees its destroyed slots.
+  void _flush(ResourceType type) noexcept;
+  void _flush_if_immediate(ResourceType type) noexcept;
+  static void _delete_pending(ResourceType type, Pool& pool) noexcept;
+
+  Pool _pools[ResourceTypeCount];
+  bool _deferred { false };
+};
+} // namespace fre2d
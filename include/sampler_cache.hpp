@@ -0,0 +1,62 @@
+// MIT License
+//
+// Copyright (c) 2025 Ferhat Geçdoğan All Rights Reserved.
+// Distributed under the terms of the MIT License.
+//
+#pragma once
+
+#include <glad/glad.h>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace fre2d {
+namespace detail::sampler_cache {
+// GL_TEXTURE_MAX_ANISOTROPY and GL_MAX_TEXTURE_MAX_ANISOTROPY are core in 4.6
+// (and ARB/EXT_texture_filter_anisotropic before), our glad stops at 4.5.
+static constexpr GLenum texture_max_anisotropy { 0x84FE };
+static constexpr GLenum max_texture_max_anisotropy { 0x84FF };
+static constexpr GLfloat default_anisotropy { 1.f }; // 1 = disabled
+} // namespace fre2d::detail::sampler_cache
+
+// filtering and wrapping state of Texture; key of SamplerCache.
+struct SamplerDesc {
+  GLenum min_filter;
+  GLenum mag_filter;
+  GLenum wrap_s;
+  GLenum wrap_t;
+  GLfloat anisotropy;
+
+  friend bool operator==(const SamplerDesc& lhs, const SamplerDesc& rhs) noexcept = default;
+};
+
+// sampler objects shared by every Texture with same SamplerDesc; e.g. all
+// glyphs of a Font use one sampler. Texture::bind() binds sampler to the same
+// unit, so sampler state overrides texture parameters.
+//
+// one per thread (like Texture::get_default_texture()), since sampler names
+// belong to context that is current on that thread.
+class SamplerCache {
+public:
+  [[nodiscard]] static SamplerCache& get() noexcept;
+
+  SamplerCache(const SamplerCache&) = delete;
+  SamplerCache& operator=(const SamplerCache&) = delete;
+
+  // creates sampler on first use.
+  [[nodiscard]] GLuint get_sampler(const SamplerDesc& desc) noexcept;
+  void bind(GLuint texture_unit, const SamplerDesc& desc) noexcept;
+  // deletes every sampler; call it before destroying context of this thread.
+  // samplers are not deleted on thread exit, context is usually gone by then.
+  void clear() noexcept;
+
+  [[nodiscard]] std::size_t get_sampler_count() const noexcept;
+  // 1 if anisotropic filtering is not supported.
+  [[nodiscard]] static GLfloat get_max_anisotropy() noexcept;
+private:
+  SamplerCache() noexcept = default;
+
+  // few distinct descs in practice; linear search beats hashing here.
+  std::vector<std::pair<SamplerDesc, GLuint>> _samplers;
+};
+} // namespace fre2d
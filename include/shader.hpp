@@ -5,11 +5,11 @@
 //
 #pragma once
 
-#include <memory>
 #include <glad/glad.h>
 #include <glm/glm.hpp>
 #include "config.hpp"
 #include "light.hpp"
+#include "resource_registry.hpp"
 
 namespace fre2d {
 namespace detail::shader {
@@ -43,8 +43,10 @@ in vec2 TexCoords;
 in vec4 Color;
 in vec2 FragPos;
 
-out vec4 FragColor;
-
+layout (location = 0) out vec4 FragColor;
+)"
+fre2d_default_emissive_output
+R"(
 uniform sampler2D TextureSampler;
 uniform bool UseTexture;
 uniform bool AffectedByLight;
@@ -52,6 +54,7 @@ uniform bool AffectedByLight;
 fre2d_default_lighting_fragment
 fre2d_default_color_func
 fre2d_default_point_lights_blend_func
+fre2d_default_premultiply_func
 R"(
 void main() {
   vec4 default_color = calculate_color(Color, TextureSampler, TexCoords, UseTexture);
@@ -70,12 +73,95 @@ void main() {
     1.f - float(AffectedByLight)
   );
   FragColor *= default_color;
+  EmissiveColor = vec4(default_color.rgb * Emissive, default_color.a);
+
+  float texture_alpha = mix(1.f, default_color.a / max(Color.a, 1e-5), float(UseTexture));
+  FragColor = premultiply_output(FragColor, texture_alpha);
+  EmissiveColor = premultiply_output(EmissiveColor, texture_alpha);
+})";
+
+// same as defaults, but TextureSampler is sampler2DArray and layer comes from
+// vertex; so sprites on different TextureAtlas pages (array layers) share one
+// texture bind. use with TextureAtlas created with use_array = true.
+static constexpr auto default_array_vertex =
+fre2d_default_glsl_version
+fre2d_default_buffer_layouts
+fre2d_default_layer_layout
+R"(
+out vec2 TexCoords;
+out vec4 Color;
+out vec2 FragPos;
+flat out float Layer;
+)"
+fre2d_default_uniforms
+R"(
+void main() {
+  gl_Position = Projection * View * Model * vec4(attr_Position, 0.f, 1.f);
+  FragPos = vec2(Model * vec4(attr_Position, 0.f, 1.f));
+)"
+  fre2d_default_tex_coords
+R"(
+  Color = attr_Color;
+  Layer = attr_Layer;
+}
+)";
+
+static constexpr auto default_array_fragment =
+R"(#version 450 core
+
+in vec2 TexCoords;
+in vec4 Color;
+in vec2 FragPos;
+flat in float Layer;
+
+layout (location = 0) out vec4 FragColor;
+)"
+fre2d_default_emissive_output
+R"(
+uniform sampler2DArray TextureSampler;
+uniform bool UseTexture;
+uniform bool AffectedByLight;
+)"
+fre2d_default_lighting_fragment
+fre2d_default_color_func
+fre2d_default_point_lights_blend_func
+fre2d_default_array_sampler_funcs
+fre2d_default_premultiply_func
+R"(
+void main() {
+  vec3 tex_coords = vec3(TexCoords, Layer);
+  vec4 default_color = calculate_color(Color, TextureSampler, tex_coords, UseTexture);
+
+  FragColor = mix(
+    point_lights_blend_func(
+      calculate_ambient_light(global_ambient_light),
+      default_color.a,
+      TextureSampler,
+      tex_coords,
+      FragPos
+    ),
+    vec4(1.f, 1.f, 1.f, 1.f),
+    1.f - float(AffectedByLight)
+  );
+  FragColor *= default_color;
+  EmissiveColor = vec4(default_color.rgb * Emissive, default_color.a);
+
+  float texture_alpha = mix(1.f, default_color.a / max(Color.a, 1e-5), float(UseTexture));
+  FragColor = premultiply_output(FragColor, texture_alpha);
+  EmissiveColor = premultiply_output(EmissiveColor, texture_alpha);
 })";
 
 static constexpr auto info_log_size { 512 };
 static constexpr bool initialize_now { true };
+static constexpr bool default_deferred { false };
+
+// GL_KHR_parallel_shader_compile (and its ARB twin) is not part of core profile,
+// so our glad does not define it; both extensions share the same token.
+static constexpr GLenum completion_status_khr { 0x91B1 };
 } // namespace fre2d::detail::shader
 
+// like Texture, copies share program; it's deleted (by ResourceRegistry) when
+// last copy goes out of scope, or by release() for all of them.
 class Shader {
 public:
   Shader() noexcept;
@@ -83,17 +169,36 @@ public:
   // currently fre2d does not support reading from file,
   // it's easy to implement but idk. you can use your own approach to read file,
   // then pass it to ctor here.
+  // set deferred = true to only submit compile and link commands;
+  // then check is_ready() before drawing with it. if driver supports
+  // KHR_parallel_shader_compile, programs are compiled in background threads,
+  // so submitting all of them up front does not block render thread.
   Shader(const char* vertex_shader,
-         const char* fragment_shader) noexcept;
+         const char* fragment_shader,
+         bool deferred = detail::shader::default_deferred) noexcept;
   Shader(GLuint program_id) noexcept;
+  // copies share program; last one that goes out of scope deletes it.
+  Shader(const Shader& shader) noexcept;
+  Shader(Shader&& shader) noexcept;
+  Shader& operator=(const Shader& shader) noexcept;
+  Shader& operator=(Shader&& shader) noexcept;
   ~Shader() noexcept;
 
   void initialize(
     const char* vertex_shader = detail::shader::default_vertex,
-    const char* fragment_shader = detail::shader::default_fragment
+    const char* fragment_shader = detail::shader::default_fragment,
+    bool deferred = detail::shader::default_deferred
   ) noexcept;
 
-  [[nodiscard]] const GLuint& get_program_id() const noexcept;
+  // returns true if program is linked (or failed to link, which is logged),
+  // otherwise deferred compilation is still in progress. never blocks
+  // when parallel compile is supported.
+  [[nodiscard]] bool is_ready() const noexcept;
+  [[nodiscard]] static bool is_parallel_compile_supported() noexcept;
+
+  // 0 if not initialized yet or released.
+  [[nodiscard]] GLuint get_program_id() const noexcept;
+  [[nodiscard]] const ShaderHandle& get_handle() const noexcept;
   [[nodiscard]] GLuint get_uniform_location(const char* uniform_name) const noexcept;
 
   void use() const noexcept;
@@ -149,6 +254,10 @@ public:
   void set_double_mat4x3(const char* uniform_name, const glm::f64mat4x3& value) const noexcept;
   void set_double_mat4x4(const char* uniform_name, const glm::f64mat4x4& value) const noexcept;
 private:
-  std::shared_ptr<GLuint> _program_id;
+  void _finalize() const noexcept;
+
+  // stage objects are kept in registry until compilation is completed, so
+  // we can read their info logs; copies made before is_ready() see them too.
+  ShaderHandle _handle;
 };
 } // namespace fre2d
\ No newline at end of file
@@ -6,6 +6,7 @@
 #pragma once
 
 #include <glad/glad.h>
+#include "resource_registry.hpp"
 #include <vector>
 
 namespace fre2d {
@@ -21,14 +22,15 @@ public:
   void bind() const noexcept;
   void unbind() const noexcept;
 
-  [[nodiscard]] const GLuint& get_ssbo_id() const noexcept;
+  [[nodiscard]] GLuint get_ssbo_id() const noexcept;
+  [[nodiscard]] const BufferHandle& get_handle() const noexcept;
 
   void empty_initialize(GLint binding) noexcept;
 
   template<typename T>
   void initialize(GLint binding, const std::vector<T>& buffer) noexcept;
 private:
-  GLuint _ssbo_id;
+  BufferHandle _handle;
   GLint _binding_id;
 };
 } // namespace fre2d
\ No newline at end of file
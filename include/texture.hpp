@@ -6,11 +6,22 @@
 #pragma once
 
 #include <glad/glad.h>
-#include <memory>
+#include "resource_registry.hpp"
+#include "sampler_cache.hpp"
+#include "texture_format.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <vector>
 
 namespace fre2d {
 struct WrapOptions;
 class Texture;
+class Framebuffer;
+class AsyncTextureLoader;
+class AssetPack;
+struct QoiHeader;
 
 namespace detail::texture {
 static constexpr bool default_use_nearest { true };
@@ -18,6 +29,8 @@ static constexpr bool default_use_mipmap { true };
 static constexpr GLuint default_wrap_x_opt { GL_CLAMP_TO_EDGE };
 static constexpr GLuint default_wrap_y_opt { GL_CLAMP_TO_EDGE };
 static constexpr GLuint default_internal_format { GL_RGBA8 };
+static constexpr TextureFormat default_format { TextureFormatRgba8 };
+static constexpr bool default_premultiply_alpha { false };
 static constexpr GLuint default_color_attachment { GL_COLOR_ATTACHMENT0 };
 static constexpr unsigned char default_transparent_pixel[4] { 0, 0, 0, 0 };
 } // namespace fre2d::detail::texture
@@ -32,14 +45,24 @@ enum ChannelsSpecifier : GLint {
 
 // TODO: support multisample textures
 // also support texture units. we use GL_TEXTURE0 every time.
+//
+// copies of Texture share same GL texture (see ResourceRegistry); it's
+// destroyed once last copy goes out of scope, or for every copy by
+// release(). either way, GL texture is deleted by ResourceRegistry (at
+// once, or in its end_frame() if app calls it). per-draw users (Mesh,
+// AdditionalTexturesInfo) keep only TextureHandle, so Texture must outlive
+// them; stale handles bind default texture instead of a dead name.
 class Texture {
 public:
   // for _framebuffer_load private function
   friend class Framebuffer;
   friend class Font;
+  friend class AsyncTextureLoader;
+  friend class TextureAtlas;
 
   // sets GL_TEXTURE_WRAP_S and GL_TEXTURE_WRAP_T.
   // GL_TEXTURE_MIN_FILTER and GL_TEXTURE_MAG_FILTER is defined by use_nearest and use_mipmap.
+  // they end up in shared sampler object (see SamplerCache), not in texture.
   struct WrapOptions {
     constexpr explicit WrapOptions(GLuint wrap_x = detail::texture::default_wrap_x_opt,
                                    GLuint wrap_y = detail::texture::default_wrap_y_opt)
@@ -65,10 +88,16 @@ public:
     GLsizei height = -1,
     bool use_nearest = detail::texture::default_use_nearest,
     bool use_mipmap = detail::texture::default_use_mipmap,
-    const WrapOptions& texture_wrap = WrapOptions::default_value()
+    const WrapOptions& texture_wrap = WrapOptions::default_value(),
+    TextureFormat format = detail::texture::default_format,
+    bool premultiply_alpha = detail::texture::default_premultiply_alpha
   ) noexcept;
 
-  ~Texture();
+  Texture(const Texture& texture) noexcept;
+  Texture(Texture&& texture) noexcept;
+  Texture& operator=(const Texture& texture) noexcept;
+  Texture& operator=(Texture&& texture) noexcept;
+  ~Texture() noexcept;
 
   void load(GLuint texture_id) noexcept;
   void load_override(GLuint texture_id) noexcept;
@@ -76,13 +105,33 @@ public:
 
   // set use_nearest = true for pixelated, low-res images.
   // set use_nearest = false to achieve smooth transitions.
-  void load(
+  // format picks gpu storage; e.g. TextureFormatR8 for masks and lightmaps
+  // takes quarter of RGBA8. see fre2d_texreport tool to find candidates.
+  // set premultiply_alpha = true for BlendModePremultiplied; it's done in
+  // same pass as vertical flip (see process_image()).
+  // returns false if file cannot be decoded; texture is left as is then.
+  bool load(
     const char* file_path,
     GLsizei width = -1,
     GLsizei height = -1,
     bool use_nearest = detail::texture::default_use_nearest,
     bool use_mipmap = detail::texture::default_use_mipmap,
-    const WrapOptions& texture_wrap = WrapOptions::default_value()
+    const WrapOptions& texture_wrap = WrapOptions::default_value(),
+    TextureFormat format = detail::texture::default_format,
+    bool premultiply_alpha = detail::texture::default_premultiply_alpha
+  ) noexcept;
+
+  // returns immediately; file is decoded on loader's worker threads and
+  // uploaded in AsyncTextureLoader::update(). till then texture id is 0 and
+  // bind() uses default texture, so it can be drawn right away. copies made
+  // before upload get the texture too. released textures are not uploaded.
+  void load_async(
+    AsyncTextureLoader& loader,
+    const char* file_path,
+    bool use_nearest = detail::texture::default_use_nearest,
+    bool use_mipmap = detail::texture::default_use_mipmap,
+    const WrapOptions& texture_wrap = WrapOptions::default_value(),
+    bool premultiply_alpha = detail::texture::default_premultiply_alpha
   ) noexcept;
 
   void load_from_data(
@@ -92,7 +141,40 @@ public:
     bool use_nearest = detail::texture::default_use_nearest,
     bool use_mipmap = detail::texture::default_use_mipmap,
     const WrapOptions& texture_wrap = WrapOptions::default_value(),
-    int channels = 4
+    int channels = 4,
+    TextureFormat format = detail::texture::default_format
+  ) noexcept;
+
+  // loads .f2tc file written by fre2d_texc; blocks are uploaded as is, so
+  // there's no decoding and gpu keeps them compressed. mip levels come from
+  // file (use_mipmap = false uploads level 0 only). BC4 is swizzled to gray
+  // like TextureFormatR8. logs error and keeps texture empty if format is
+  // not supported by driver.
+  void load_compressed(
+    const char* file_path,
+    bool use_nearest = detail::texture::default_use_nearest,
+    bool use_mipmap = detail::texture::default_use_mipmap,
+    const WrapOptions& texture_wrap = WrapOptions::default_value()
+  ) noexcept;
+
+  void load_compressed_from_data(
+    const std::uint8_t* data,
+    std::size_t size,
+    bool use_nearest = detail::texture::default_use_nearest,
+    bool use_mipmap = detail::texture::default_use_mipmap,
+    const WrapOptions& texture_wrap = WrapOptions::default_value()
+  ) noexcept;
+
+  // uploads AssetTypePixels or AssetTypeCompressed entry of pack straight
+  // from its mapping; pack can be closed afterwards. format is used for
+  // pixel entries only.
+  void load_from_pack(
+    const AssetPack& pack,
+    std::string_view name,
+    bool use_nearest = detail::texture::default_use_nearest,
+    bool use_mipmap = detail::texture::default_use_mipmap,
+    const WrapOptions& texture_wrap = WrapOptions::default_value(),
+    TextureFormat format = detail::texture::default_format
   ) noexcept;
 
   // no checks, just calls what you need
@@ -107,22 +189,34 @@ public:
     int channels = 4
   ) noexcept;
 
+  // records sampler state that bind() uses; texture parameters are set too,
+  // for code that samples get_texture_id() without bind().
   void set_parameters(
     bool use_nearest = detail::texture::default_use_nearest,
     bool use_mipmap = detail::texture::default_use_mipmap,
     const WrapOptions& texture_wrap = WrapOptions::default_value()
   ) noexcept;
+  // clamped to SamplerCache::get_max_anisotropy(); 1 disables it. only
+  // matters for mipmapped textures that are minified (e.g. zoomed out).
+  void set_anisotropy(GLfloat anisotropy) noexcept;
 
   [[nodiscard]] static const Texture& get_default_texture() noexcept;
 
   void bind(GLuint texture_unit = 0) const noexcept;
+  // same as above, for handles kept by Mesh, AdditionalTexturesInfo etc.
+  static void bind(TextureHandle handle, GLuint texture_unit = 0) noexcept;
   void unbind() const noexcept;
   void attach(const Framebuffer& fb, GLuint attachment = detail::texture::default_color_attachment) const noexcept;
 
-  [[nodiscard]] const GLuint& get_texture_id() const noexcept;
+  // 0 if not loaded yet or released.
+  [[nodiscard]] GLuint get_texture_id() const noexcept;
+  [[nodiscard]] const TextureHandle& get_handle() const noexcept;
+  // std::nullopt for textures that are only wrapped (Texture(GLuint));
+  // bind() leaves their own parameters in effect.
+  [[nodiscard]] const std::optional<SamplerDesc>& get_sampler_desc() const noexcept;
 
   friend bool operator==(const Texture& lhs, const Texture& rhs) noexcept {
-    return lhs.get_texture_id() == rhs.get_texture_id();
+    return lhs._handle == rhs._handle;
   }
 
   friend bool operator!=(const Texture& lhs, const Texture& rhs) noexcept {
@@ -130,14 +224,39 @@ public:
   }
 private:
   friend class Framebuffer;
+
+  // (re)allocates mutable storage without changing texture name; so copies and
+  // handles of this Texture (like AdditionalTexturesInfo) stay valid after resizing.
+  void _framebuffer_load(GLsizei width, GLsizei height, GLint internal_format = detail::texture::default_internal_format) noexcept;
+  // decodes qoi bytes and uploads them; false if they cannot be decoded.
+  [[nodiscard]] bool _load_qoi(
+    const std::vector<std::uint8_t>& bytes,
+    const QoiHeader& header,
+    bool use_nearest,
+    bool use_mipmap,
+    const WrapOptions& texture_wrap,
+    TextureFormat format,
+    bool premultiply_alpha
+  ) noexcept;
+  // applies sampler state to texture parameters and sampler of bind(); kept
+  // for reloads of evicted texture too.
+  void _set_sampler(const SamplerDesc& desc) noexcept;
+  // makes texture evictable (see GpuMemoryTracker); file_path = nullptr
+  // (failed load) or other formats make it resident.
+  void _set_stream_source(
+    const char* file_path,
+    bool use_nearest,
+    bool use_mipmap,
+    const WrapOptions& texture_wrap,
+    TextureFormat format,
+    bool premultiply_alpha
+  ) const noexcept;
+
+  TextureHandle _handle;
+  // they are per copy, unlike texture itself; so copies made before load
+  // keep their own formats. sampler object of bind() is kept in registry.
   GLint _internal_format;
   GLint _format;
-  // we need to track it since it can be copied, which means; destructor will be
-  // invoked more than once. maybe it should be better if we just use the same approach
-  // as the below one; otherwise we need to wrap _internal_format and _format as pointer too;
-  // that's because copy would make them differ from others, so one would be GL_RGB;
-  // and otherwise GL_RGBA? so it's TODO:
-  // https://www.khronos.org/opengl/wiki_opengl/index.php?title=Common_Mistakes#RAII_and_hidden_destructor_calls
-  std::shared_ptr<GLuint> _texture_id;
+  std::optional<SamplerDesc> _sampler;
 };
 } // namespace fre2d
\ No newline at end of file
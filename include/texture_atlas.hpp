@@ -0,0 +1,118 @@
+// MIT License
+//
+// Copyright (c) 2025 Ferhat Geçdoğan All Rights Reserved.
+// Distributed under the terms of the MIT License.
+//
+#pragma once
+
+#include "texture.hpp"
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace fre2d {
+namespace detail::texture_atlas {
+static constexpr GLsizei default_page_size { 2048 };
+// pixels around each image, filled with its edge pixels. with padding p,
+// first floor(log2(p)) + 1 mip levels do not bleed into neighbours; so
+// pages only have that many levels.
+static constexpr GLsizei default_padding { 4 };
+static constexpr std::size_t default_max_pages { 4 };
+static constexpr bool default_use_array { false };
+} // namespace fre2d::detail::texture_atlas
+
+// where an image lives in TextureAtlas; uv_min/uv_max cover image itself,
+// not its gutter. bottom-left origin, like Texture::load().
+struct AtlasRegion {
+  std::size_t page; // also array layer, if atlas uses texture array.
+  glm::vec2 uv_min;
+  glm::vec2 uv_max;
+  GLsizei width;
+  GLsizei height;
+};
+
+// packs images into few big RGBA8 pages with skyline bottom-left packer,
+// so sprites from different files share one texture bind. images can be
+// inserted at any time; new page is created when none has room.
+//
+// inserted pixels are uploaded right away, but mipmaps are regenerated
+// only in update_mipmaps(); call it after bunch of insert()s.
+//
+// with use_array = true, pages are layers of one GL_TEXTURE_2D_ARRAY and
+// every get_page() returns same Texture; draw them with
+// detail::shader::default_array_vertex/default_array_fragment, which read
+// layer from vertices. array grows (doubles, copied on gpu) when it's full.
+class TextureAtlas {
+public:
+  explicit TextureAtlas(
+    GLsizei page_size = detail::texture_atlas::default_page_size,
+    GLsizei padding = detail::texture_atlas::default_padding,
+    bool use_nearest = detail::texture::default_use_nearest,
+    bool use_mipmap = detail::texture::default_use_mipmap,
+    std::size_t max_pages = detail::texture_atlas::default_max_pages,
+    bool use_array = detail::texture_atlas::default_use_array
+  ) noexcept;
+  ~TextureAtlas() noexcept = default;
+
+  // pixels are tightly packed and bottom-up; channels is 3 or 4.
+  // returns std::nullopt if image is bigger than page or every page is full.
+  [[nodiscard]] std::optional<AtlasRegion> insert(
+    const unsigned char* pixels,
+    GLsizei width,
+    GLsizei height,
+    int channels = 4
+  ) noexcept;
+  [[nodiscard]] std::optional<AtlasRegion> insert(const char* file_path) noexcept;
+
+  void update_mipmaps() noexcept;
+
+  [[nodiscard]] const Texture& get_page(std::size_t index) const noexcept;
+  [[nodiscard]] std::size_t get_page_count() const noexcept;
+  [[nodiscard]] const GLsizei& get_page_size() const noexcept;
+  [[nodiscard]] const GLsizei& get_padding() const noexcept;
+  [[nodiscard]] const bool& is_array() const noexcept;
+  // used area / total area of created pages, in [0, 1].
+  [[nodiscard]] float get_occupancy() const noexcept;
+private:
+  struct SkylineNode {
+    GLsizei x;
+    GLsizei y;
+    GLsizei width;
+  };
+
+  struct Page {
+    Texture texture;
+    std::vector<SkylineNode> skyline;
+    std::size_t used_area;
+    bool mipmaps_dirty;
+  };
+
+  // finds lowest position (then narrowest fit) for width x height block;
+  // returns false if it doesn't fit.
+  [[nodiscard]] bool _find_position(
+    const Page& page,
+    GLsizei width,
+    GLsizei height,
+    std::size_t& node_index,
+    GLsizei& x,
+    GLsizei& y
+  ) const noexcept;
+  void _place(Page& page, std::size_t node_index, GLsizei x, GLsizei y, GLsizei width, GLsizei height) noexcept;
+  void _add_page() noexcept;
+  // immutable RGBA8 storage with _mip_levels levels; layers = 0 means GL_TEXTURE_2D.
+  [[nodiscard]] GLuint _create_storage(GLsizei layers) const noexcept;
+  // reports storage of texture to GpuMemoryTracker.
+  void _track_storage(const Texture& texture, GLsizei layers) const noexcept;
+
+  GLsizei _page_size;
+  GLsizei _padding;
+  GLsizei _mip_levels;
+  bool _use_nearest;
+  bool _use_mipmap;
+  bool _use_array;
+  std::size_t _max_pages;
+  GLsizei _layer_capacity;
+  std::vector<Page> _pages;
+};
+} // namespace fre2d
@@ -0,0 +1,58 @@
+// MIT License
+//
+// Copyright (c) 2025 Ferhat Geçdoğan All Rights Reserved.
+// Distributed under the terms of the MIT License.
+//
+#pragma once
+
+#include <glad/glad.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace fre2d {
+// gpu storage of Texture. compact ones are converted on cpu before upload;
+// R8 and RG8 are swizzled, so default shaders see them as gray (+ alpha).
+enum TextureFormat : std::uint8_t {
+  TextureFormatRgba8,
+  TextureFormatSrgb8Alpha8, // same bytes as RGBA8, decoded to linear on sampling.
+  TextureFormatRgb565, // opaque color, 2 bytes; alpha is 1.
+  TextureFormatRgba4, // 2 bytes; for flat-colored UI with alpha.
+  TextureFormatRg8, // gray + alpha (red and alpha channels of source).
+  TextureFormatR8 // gray; red channel of source, alpha is 1.
+};
+
+struct TextureFormatInfo {
+  GLenum internal_format;
+  GLenum format; // of uploaded pixels.
+  GLenum type;
+  std::size_t bytes_per_pixel; // of gpu storage (and converted pixels).
+  bool needs_conversion;
+};
+
+// source_channels is 3 (RGB) or 4 (RGBA); only matters for formats that
+// upload source as is.
+[[nodiscard]] TextureFormatInfo get_texture_format_info(TextureFormat format, int source_channels = 4) noexcept;
+
+// packs tightly packed 8-bit RGB(A) pixels into format; destination is
+// resized to fit. uses SSE2 or NEON for RGBA sources where available,
+// scalar otherwise. 5/6/4-bit channels are truncated, not rounded.
+void convert_pixels(
+  const std::uint8_t* source,
+  int source_channels,
+  std::size_t pixel_count,
+  TextureFormat format,
+  std::vector<std::uint8_t>& destination
+) noexcept;
+
+// smallest format that keeps pixels exact (R8 for gray, RG8 for gray with
+// alpha), or RGB565/RGBA4 for color if allow_lossy is true; RGBA8 otherwise.
+[[nodiscard]] TextureFormat suggest_texture_format(
+  const std::uint8_t* pixels,
+  int channels,
+  std::size_t pixel_count,
+  bool allow_lossy = false
+) noexcept;
+
+[[nodiscard]] const char* get_texture_format_name(TextureFormat format) noexcept;
+} // namespace fre2d
@@ -0,0 +1,51 @@
+// MIT License
+//
+// Copyright (c) 2025 Ferhat Geçdoğan All Rights Reserved.
+// Distributed under the terms of the MIT License.
+//
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace fre2d {
+namespace detail::thread_pool {
+// 0 means std::thread::hardware_concurrency() - 1 (render thread stays free), at least 1.
+static constexpr std::size_t default_thread_count { 0 };
+} // namespace fre2d::detail::thread_pool
+
+// fixed set of worker threads for cpu-side jobs (encoding, decoding etc.).
+// notice: jobs must not call OpenGL functions; context is only current
+// on render thread.
+class ThreadPool {
+public:
+  explicit ThreadPool(std::size_t thread_count = detail::thread_pool::default_thread_count) noexcept;
+  // finishes queued jobs, then joins workers.
+  ~ThreadPool() noexcept;
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  void submit(std::function<void()> job) noexcept;
+  // blocks until queue is empty and no job is running.
+  void wait_idle() noexcept;
+
+  [[nodiscard]] std::size_t get_thread_count() const noexcept;
+  [[nodiscard]] std::size_t get_queued_count() const noexcept;
+private:
+  void _worker_loop() noexcept;
+
+  std::vector<std::thread> _workers;
+  std::deque<std::function<void()>> _jobs;
+  mutable std::mutex _mutex;
+  std::condition_variable _job_available;
+  std::condition_variable _idle;
+  std::size_t _running_count;
+  bool _stopping;
+};
+} // namespace fre2d
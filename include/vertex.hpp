@@ -12,6 +12,7 @@ namespace detail::vertex {
 static constexpr auto default_position = glm::vec2(0.f, 0.f);
 static constexpr auto default_color = glm::vec4(1.f, 1.f, 1.f, 1.f);
 static constexpr auto default_tex_coord = glm::vec2(0.f, 0.f);
+static constexpr float default_layer { 0.f };
 } // namespace fre2d::detail::vertex
 
 // contains no texture coordinates; used for Polygon class to explicitly use
@@ -48,15 +49,18 @@ public:
   constexpr Vertex(
     const glm::vec2& position = detail::vertex::default_position,
     const glm::vec4& color = detail::vertex::default_color,
-    const glm::vec2& tex_coord = detail::vertex::default_tex_coord
-  ) noexcept : _position{position}, _color{color}, _tex_coord{tex_coord} {}
+    const glm::vec2& tex_coord = detail::vertex::default_tex_coord,
+    float layer = detail::vertex::default_layer
+  ) noexcept : _position{position}, _color{color}, _tex_coord{tex_coord}, _layer{layer} {}
 
   constexpr Vertex(
     const Vertex2& vert2,
-    const glm::vec2& tex_coord = detail::vertex::default_tex_coord
+    const glm::vec2& tex_coord = detail::vertex::default_tex_coord,
+    float layer = detail::vertex::default_layer
   ) noexcept : _position{vert2.get_position()},
                _color{vert2.get_color()},
-               _tex_coord{tex_coord} {}
+               _tex_coord{tex_coord},
+               _layer{layer} {}
 
   constexpr void set_position(const glm::vec2& position) noexcept {
     this->_position = position;
@@ -70,6 +74,11 @@ public:
     this->_tex_coord = tex_coord;
   }
 
+  // texture array layer; default shaders ignore it, array ones sample it.
+  constexpr void set_layer(float layer) noexcept {
+    this->_layer = layer;
+  }
+
   constexpr void set_vertex2(const Vertex2& vert2) noexcept {
     this->set_position(vert2.get_position());
     this->set_color(vert2.get_color());
@@ -86,10 +95,15 @@ public:
   [[nodiscard]] constexpr const glm::vec2& get_tex_coord() const noexcept {
     return this->_tex_coord;
   }
+
+  [[nodiscard]] constexpr const float& get_layer() const noexcept {
+    return this->_layer;
+  }
 private:
   glm::vec2 _position;
   glm::vec4 _color;
   glm::vec2 _tex_coord;
+  float _layer;
 };
 
 using Vertex3 = Vertex;
@@ -6,6 +6,8 @@
 #pragma once
 
 #include "vertex.hpp"
+#include "resource_registry.hpp"
+#include "gpu_memory_tracker.hpp"
 #include <glad/glad.h>
 #include <vector>
 #include <array>
@@ -29,11 +31,12 @@ public:
 
   // 6 is not a magic number; reserved for framebuffer rectangle (6 vertices)
   template<size_t N>
-  explicit VertexBuffer(const std::array<Vertex, N>& vertices) noexcept
-    : _vbo_id{0} {
+  explicit VertexBuffer(const std::array<Vertex, N>& vertices) noexcept {
     this->initialize<N>(vertices);
   }
 
+  // buffer is deleted by ResourceRegistry (at once or in end_frame()); copies
+  // (e.g. of Mesh) do not delete it twice.
   ~VertexBuffer() noexcept;
 
   void bind() const noexcept;
@@ -44,13 +47,16 @@ public:
 
   template<size_t N>
   void initialize(const std::array<Vertex, N>& vertices) noexcept {
-    glCreateBuffers(1, &this->_vbo_id);
+    GLuint vbo_id { 0 };
+    glCreateBuffers(1, &vbo_id);
+    ResourceRegistry::get().assign(this->_handle, vbo_id);
     // TODO: support different usage flags
-    glNamedBufferData(this->get_vbo_id(), sizeof(vertices), vertices.data(), GL_STATIC_DRAW);
+    glNamedBufferData(vbo_id, sizeof(vertices), vertices.data(), GL_STATIC_DRAW);
+    GpuMemoryTracker::get().track(GpuMemoryClassVertexBuffer, this->_handle.value, sizeof(vertices));
   }
 
-  [[nodiscard]] const GLuint& get_vbo_id() const noexcept;
+  [[nodiscard]] GLuint get_vbo_id() const noexcept;
 private:
-  GLuint _vbo_id;
+  BufferHandle _handle;
 };
 } // namespace fre2d
\ No newline at end of file
@@ -0,0 +1,197 @@
+// MIT License
+//
+// Copyright (c) 2025 Ferhat Geçdoğan All Rights Reserved.
+// Distributed under the terms of the MIT License.
+//
+#include <asset_cache.hpp>
+#include <async_texture_loader.hpp>
+#include <gpu_memory_tracker.hpp>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+namespace fre2d {
+namespace {
+// FNV-1a; only used to find identical files, not against malicious input.
+[[nodiscard]] std::uint64_t hash_bytes(const std::vector<char>& bytes) noexcept {
+  std::uint64_t hash { 14695981039346656037ull };
+  for(const char byte: bytes) {
+    hash = (hash ^ static_cast<std::uint8_t>(byte)) * 1099511628211ull;
+  }
+  return hash;
+}
+} // anonymous namespace
+
+AssetCache::AssetCache(bool hash_contents) noexcept
+  : _stats{0, 0, 0, 0, 0}, _released_bytes_saved{0}, _hash_contents{hash_contents} {}
+
+AssetCache::~AssetCache() noexcept {
+  this->clear();
+}
+
+[[nodiscard]] Texture AssetCache::load(const char* file_path,
+                                       bool use_nearest,
+                                       bool use_mipmap,
+                                       const Texture::WrapOptions& texture_wrap,
+                                       TextureFormat format,
+                                       bool premultiply_alpha) noexcept {
+  const auto path = AssetCache::_canonicalize(file_path);
+  const LoadOptions options {
+    texture_wrap.wrap_x_opt, texture_wrap.wrap_y_opt, format, use_nearest, use_mipmap, premultiply_alpha
+  };
+  if(const auto* texture = this->_find(path, options)) {
+    return *texture;
+  }
+
+  std::uint64_t content_hash { 0 };
+  bool hashed { false };
+  if(this->_hash_contents) {
+    // file is read once more by Texture::load() on miss; it's in os cache by then.
+    std::ifstream file(path, std::ios::binary);
+    if(file) {
+      content_hash = hash_bytes(std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()));
+      hashed = true;
+      if(const auto found = this->_contents.find(ContentKey{content_hash, options}); found != this->_contents.end()) {
+        auto& entry = this->_entries.at(found->second);
+        entry.paths.push_back(path);
+        this->_paths.emplace(PathKey{path, options}, found->second);
+        ++entry.use_count;
+        ++entry.hit_count;
+        ++this->_stats.content_hits;
+        return entry.texture;
+      }
+    }
+  }
+
+  ++this->_stats.misses;
+  Texture texture;
+  if(!texture.load(file_path, -1, -1, use_nearest, use_mipmap, texture_wrap, format, premultiply_alpha)) {
+    return Texture();
+  }
+  auto& entry = this->_insert(path, options, texture);
+  if(hashed) {
+    entry.content_hash = content_hash;
+    entry.has_content_hash = true;
+    this->_contents.emplace(ContentKey{content_hash, options}, texture.get_handle().value);
+  }
+  return texture;
+}
+
+[[nodiscard]] Texture AssetCache::load_async(AsyncTextureLoader& loader,
+                                             const char* file_path,
+                                             bool use_nearest,
+                                             bool use_mipmap,
+                                             const Texture::WrapOptions& texture_wrap,
+                                             bool premultiply_alpha) noexcept {
+  const auto path = AssetCache::_canonicalize(file_path);
+  const LoadOptions options {
+    texture_wrap.wrap_x_opt, texture_wrap.wrap_y_opt, detail::texture::default_format,
+    use_nearest, use_mipmap, premultiply_alpha
+  };
+  if(const auto* texture = this->_find(path, options)) {
+    return *texture;
+  }
+  ++this->_stats.misses;
+  Texture texture;
+  texture.load_async(loader, file_path, use_nearest, use_mipmap, texture_wrap, premultiply_alpha);
+  this->_insert(path, options, texture);
+  return texture;
+}
+
+void AssetCache::release(const Texture& texture) noexcept {
+  const auto entry = this->_entries.find(texture.get_handle().value);
+  if(entry == this->_entries.end()) {
+    return;
+  }
+  if(--entry->second.use_count == 0) {
+    this->_erase(entry);
+  }
+}
+
+void AssetCache::clear() noexcept {
+  while(!this->_entries.empty()) {
+    this->_erase(this->_entries.begin());
+  }
+}
+
+[[nodiscard]] std::size_t AssetCache::get_use_count(const Texture& texture) const noexcept {
+  const auto entry = this->_entries.find(texture.get_handle().value);
+  return entry != this->_entries.end() ? entry->second.use_count : 0;
+}
+
+[[nodiscard]] std::size_t AssetCache::get_entry_count() const noexcept {
+  return this->_entries.size();
+}
+
+[[nodiscard]] AssetCacheStats AssetCache::get_stats() const noexcept {
+  auto stats = this->_stats;
+  stats.bytes_saved = this->_released_bytes_saved;
+  for(const auto& [handle, entry]: this->_entries) {
+    stats.bytes_saved += AssetCache::_get_gpu_bytes(entry) * entry.hit_count;
+  }
+  return stats;
+}
+
+void AssetCache::reset_stats() noexcept {
+  this->_stats = AssetCacheStats{0, 0, 0, 0, 0};
+  this->_released_bytes_saved = 0;
+  for(auto& [handle, entry]: this->_entries) {
+    entry.hit_count = 0;
+  }
+}
+
+[[nodiscard]] const bool& AssetCache::get_hash_contents() const noexcept {
+  return this->_hash_contents;
+}
+
+[[nodiscard]] Texture* AssetCache::_find(const std::string& path, const LoadOptions& options) noexcept {
+  const auto found = this->_paths.find(PathKey{path, options});
+  if(found == this->_paths.end()) {
+    return nullptr;
+  }
+  const auto entry = this->_entries.find(found->second);
+  // released behind our back (e.g. by a copy, or ResourceRegistry::clear()); load again.
+  if(!ResourceRegistry::get().is_valid(entry->second.texture.get_handle())) {
+    this->_erase(entry);
+    return nullptr;
+  }
+  ++entry->second.use_count;
+  ++entry->second.hit_count;
+  ++this->_stats.hits;
+  if(entry->second.texture.get_texture_id() == 0) {
+    ++this->_stats.coalesced;
+  }
+  return &entry->second.texture;
+}
+
+AssetCache::Entry& AssetCache::_insert(const std::string& path, const LoadOptions& options, const Texture& texture) noexcept {
+  const auto handle = texture.get_handle().value;
+  this->_paths.emplace(PathKey{path, options}, handle);
+  return this->_entries.insert_or_assign(handle, Entry{texture, options, {path}, 0, false, 1, 0}).first->second;
+}
+
+void AssetCache::_erase(std::unordered_map<std::uint32_t, Entry>::iterator entry) noexcept {
+  auto& value = entry->second;
+  for(const auto& path: value.paths) {
+    this->_paths.erase(PathKey{path, value.options});
+  }
+  if(value.has_content_hash) {
+    this->_contents.erase(ContentKey{value.content_hash, value.options});
+  }
+  this->_released_bytes_saved += AssetCache::_get_gpu_bytes(value) * value.hit_count;
+  value.texture.release();
+  this->_entries.erase(entry);
+}
+
+// what GpuMemoryTracker has for it (full mip chain included, 0 while it's
+// evicted); so stats don't query the driver per entry.
+[[nodiscard]] std::size_t AssetCache::_get_gpu_bytes(const Entry& entry) noexcept {
+  return GpuMemoryTracker::get().get_bytes(GpuMemoryClassTexture, entry.texture.get_handle().value);
+}
+
+[[nodiscard]] std::string AssetCache::_canonicalize(const char* file_path) noexcept {
+  std::error_code error;
+  const auto path = std::filesystem::weakly_canonical(file_path, error);
+  return error ? std::filesystem::path(file_path).lexically_normal().string() : path.string();
+}
+} // namespace fre2d
@@ -0,0 +1,257 @@
+// MIT License
+//
+// Copyright (c) 2025 Ferhat Geçdoğan All Rights Reserved.
+// Distributed under the terms of the MIT License.
+//
+#include <asset_pack.hpp>
+#include <algorithm>
+#include <iostream>
+
+#if defined(_WIN32)
+#  ifndef NOMINMAX
+#    define NOMINMAX
+#  endif
+#  include <windows.h>
+#else
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+namespace fre2d {
+namespace {
+[[nodiscard]] std::uint32_t read_u32(const std::uint8_t* data) noexcept {
+  return static_cast<std::uint32_t>(data[0]) | (static_cast<std::uint32_t>(data[1]) << 8) |
+         (static_cast<std::uint32_t>(data[2]) << 16) | (static_cast<std::uint32_t>(data[3]) << 24);
+}
+
+[[nodiscard]] std::uint64_t read_u64(const std::uint8_t* data) noexcept {
+  return static_cast<std::uint64_t>(read_u32(data)) | (static_cast<std::uint64_t>(read_u32(data + 4)) << 32);
+}
+
+void append_u32(std::vector<std::uint8_t>& out, std::uint32_t value) {
+  for(int i = 0; i < 4; ++i) {
+    out.push_back(static_cast<std::uint8_t>(value >> (i * 8)));
+  }
+}
+
+void append_u64(std::vector<std::uint8_t>& out, std::uint64_t value) {
+  append_u32(out, static_cast<std::uint32_t>(value));
+  append_u32(out, static_cast<std::uint32_t>(value >> 32));
+}
+
+[[nodiscard]] std::size_t align_up(std::size_t value) noexcept {
+  constexpr auto alignment = detail::asset_pack::data_alignment;
+  return (value + alignment - 1) / alignment * alignment;
+}
+} // anonymous namespace
+
+AssetPack::AssetPack(const char* file_path) noexcept {
+  this->open(file_path);
+}
+
+AssetPack::~AssetPack() noexcept {
+  this->close();
+}
+
+bool AssetPack::open(const char* file_path) noexcept {
+  this->close();
+  const auto fail = [this, file_path](const char* reason) {
+    std::cout << "fre2d error: AssetPack::open(): " << file_path << ": " << reason << ".\n";
+    this->close();
+    return false;
+  };
+#if defined(_WIN32)
+  this->_file_handle = CreateFileA(file_path, GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                   OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if(this->_file_handle == INVALID_HANDLE_VALUE) {
+    this->_file_handle = nullptr;
+    return fail("cannot open file");
+  }
+  LARGE_INTEGER file_size;
+  if(!GetFileSizeEx(this->_file_handle, &file_size) || file_size.QuadPart == 0) {
+    return fail("cannot read file size");
+  }
+  this->_mapping_handle = CreateFileMappingA(this->_file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if(!this->_mapping_handle) {
+    return fail("cannot map file");
+  }
+  this->_data = static_cast<const std::uint8_t*>(MapViewOfFile(this->_mapping_handle, FILE_MAP_READ, 0, 0, 0));
+  if(!this->_data) {
+    return fail("cannot map file");
+  }
+  this->_size = static_cast<std::size_t>(file_size.QuadPart);
+#else
+  const int descriptor { ::open(file_path, O_RDONLY) };
+  if(descriptor < 0) {
+    return fail("cannot open file");
+  }
+  struct stat status;
+  if(fstat(descriptor, &status) != 0 || status.st_size == 0) {
+    ::close(descriptor);
+    return fail("cannot read file size");
+  }
+  auto* mapped = mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0);
+  // mapping stays valid after descriptor is closed.
+  ::close(descriptor);
+  if(mapped == MAP_FAILED) {
+    return fail("cannot map file");
+  }
+  this->_data = static_cast<const std::uint8_t*>(mapped);
+  this->_size = static_cast<std::size_t>(status.st_size);
+#endif
+
+  if(this->_size < detail::asset_pack::header_size ||
+     !std::equal(detail::asset_pack::magic.begin(), detail::asset_pack::magic.end(), this->_data)) {
+    return fail("not a .f2pak file");
+  }
+  if(read_u32(this->_data + 4) != detail::asset_pack::version) {
+    return fail("unsupported version");
+  }
+  const std::size_t entry_count { read_u32(this->_data + 8) };
+  if(entry_count > (this->_size - detail::asset_pack::header_size) / detail::asset_pack::entry_size) {
+    return fail("truncated entry table");
+  }
+  this->_entry_count = entry_count;
+  // validate once, so find() and get_entry() can trust table.
+  for(std::size_t i = 0; i < entry_count; ++i) {
+    const auto* entry = this->_data + detail::asset_pack::header_size + i * detail::asset_pack::entry_size;
+    const std::uint64_t name_offset { read_u32(entry) }, name_size { read_u32(entry + 4) };
+    const auto data_offset = read_u64(entry + 24), data_size = read_u64(entry + 32);
+    if(name_offset + name_size > this->_size || data_offset > this->_size || data_size > this->_size - data_offset) {
+      return fail("entry is out of file");
+    }
+    if(i > 0 && !(this->get_entry(i - 1).name < this->get_entry(i).name)) {
+      return fail("entry table is not sorted");
+    }
+  }
+  return true;
+}
+
+void AssetPack::close() noexcept {
+#if defined(_WIN32)
+  if(this->_data) {
+    UnmapViewOfFile(this->_data);
+  }
+  if(this->_mapping_handle) {
+    CloseHandle(this->_mapping_handle);
+  }
+  if(this->_file_handle) {
+    CloseHandle(this->_file_handle);
+  }
+  this->_mapping_handle = this->_file_handle = nullptr;
+#else
+  if(this->_data) {
+    munmap(const_cast<std::uint8_t*>(this->_data), this->_size);
+  }
+#endif
+  this->_data = nullptr;
+  this->_size = this->_entry_count = 0;
+}
+
+[[nodiscard]] std::optional<AssetEntry> AssetPack::find(std::string_view name) const noexcept {
+  std::size_t first { 0 }, last { this->_entry_count };
+  while(first < last) {
+    const auto middle = first + (last - first) / 2;
+    const auto entry = this->get_entry(middle);
+    if(entry.name == name) {
+      return entry;
+    }
+    if(entry.name < name) {
+      first = middle + 1;
+    } else {
+      last = middle;
+    }
+  }
+  return std::nullopt;
+}
+
+[[nodiscard]] AssetEntry AssetPack::get_entry(std::size_t index) const noexcept {
+  const auto* entry = this->_data + detail::asset_pack::header_size + index * detail::asset_pack::entry_size;
+  return AssetEntry{
+    std::string_view(reinterpret_cast<const char*>(this->_data + read_u32(entry)), read_u32(entry + 4)),
+    static_cast<AssetType>(read_u32(entry + 8)),
+    read_u32(entry + 12),
+    read_u32(entry + 16),
+    read_u32(entry + 20),
+    this->_data + read_u64(entry + 24),
+    static_cast<std::size_t>(read_u64(entry + 32))
+  };
+}
+
+[[nodiscard]] bool AssetPack::is_open() const noexcept {
+  return this->_data != nullptr;
+}
+
+[[nodiscard]] const std::size_t& AssetPack::get_entry_count() const noexcept {
+  return this->_entry_count;
+}
+
+[[nodiscard]] const std::size_t& AssetPack::get_size() const noexcept {
+  return this->_size;
+}
+
+void AssetPackWriter::add(std::string name,
+                          AssetType type,
+                          const std::uint8_t* data,
+                          std::size_t size,
+                          std::uint32_t width,
+                          std::uint32_t height,
+                          std::uint32_t channels) noexcept {
+  this->_entries.push_back(Entry{
+    std::move(name), type, width, height, channels, std::vector<std::uint8_t>(data, data + size)
+  });
+}
+
+[[nodiscard]] std::vector<std::uint8_t> AssetPackWriter::write() const noexcept {
+  // table is sorted by name for AssetPack::find(); entries are not moved.
+  std::vector<const Entry*> sorted;
+  for(const auto& entry: this->_entries) {
+    sorted.push_back(&entry);
+  }
+  std::sort(sorted.begin(), sorted.end(), [](const Entry* lhs, const Entry* rhs) {
+    return lhs->name < rhs->name;
+  });
+
+  std::size_t offset { detail::asset_pack::header_size + sorted.size() * detail::asset_pack::entry_size };
+  std::vector<std::size_t> name_offsets, data_offsets;
+  for(const auto* entry: sorted) {
+    name_offsets.push_back(offset);
+    offset += entry->name.size();
+  }
+  for(const auto* entry: sorted) {
+    offset = align_up(offset);
+    data_offsets.push_back(offset);
+    offset += entry->data.size();
+  }
+
+  std::vector<std::uint8_t> out(detail::asset_pack::magic.begin(), detail::asset_pack::magic.end());
+  out.reserve(offset);
+  append_u32(out, detail::asset_pack::version);
+  append_u32(out, static_cast<std::uint32_t>(sorted.size()));
+  append_u32(out, 0);
+  for(std::size_t i = 0; i < sorted.size(); ++i) {
+    append_u32(out, static_cast<std::uint32_t>(name_offsets[i]));
+    append_u32(out, static_cast<std::uint32_t>(sorted[i]->name.size()));
+    append_u32(out, sorted[i]->type);
+    append_u32(out, sorted[i]->width);
+    append_u32(out, sorted[i]->height);
+    append_u32(out, sorted[i]->channels);
+    append_u64(out, data_offsets[i]);
+    append_u64(out, sorted[i]->data.size());
+  }
+  for(const auto* entry: sorted) {
+    out.insert(out.end(), entry->name.begin(), entry->name.end());
+  }
+  for(std::size_t i = 0; i < sorted.size(); ++i) {
+    out.resize(data_offsets[i], 0);
+    out.insert(out.end(), sorted[i]->data.begin(), sorted[i]->data.end());
+  }
+  return out;
+}
+
+[[nodiscard]] std::size_t AssetPackWriter::get_entry_count() const noexcept {
+  return this->_entries.size();
+}
+} // namespace fre2d
@@ -0,0 +1,184 @@
+// MIT License
+//
+// Copyright (c) 2025 Ferhat Geçdoğan All Rights Reserved.
+// Distributed under the terms of the MIT License.
+//
+#include <async_texture_loader.hpp>
+#include <iostream>
+#include <limits>
+#include <qoi.hpp>
+#include <image_ops.hpp>
+#include <stb_image.h>
+
+namespace fre2d {
+AsyncTextureLoader::AsyncTextureLoader(ThreadPool& workers, std::size_t ring_capacity) noexcept
+  : _workers{workers}, _ring(ring_capacity), _state{std::make_shared<SharedState>()} {}
+
+AsyncTextureLoader::~AsyncTextureLoader() noexcept {
+  std::unique_lock lock(this->_state->mutex);
+  this->_state->decoded.wait(lock, [this] {
+    return this->_state->decoding_count == 0;
+  });
+  for(const auto& image: this->_state->ready) {
+    this->_ring.release(image.span);
+  }
+  this->_state->ready.clear();
+}
+
+std::size_t AsyncTextureLoader::update(std::size_t byte_budget) noexcept {
+  this->_ring.reclaim();
+  std::size_t uploaded_bytes { 0 };
+  while(uploaded_bytes < byte_budget || uploaded_bytes == 0) {
+    DecodedImage image;
+    {
+      std::lock_guard lock(this->_state->mutex);
+      if(this->_state->ready.empty()) {
+        break;
+      }
+      image = std::move(this->_state->ready.front());
+      this->_state->ready.pop_front();
+    }
+    if(!ResourceRegistry::get().is_valid(image.target)) {
+      this->_ring.release(image.span);
+      continue; // texture is released; nothing to upload into.
+    }
+    if(!image.span.data && !image.pixels) {
+      std::cout << "error: cannot load image file " << image.file_path << '\n';
+      continue;
+    }
+    // uploads straight into target; every copy of it sees the new name.
+    // this one is a copy too, it must not drop reference of owners.
+    Texture texture;
+    texture._handle = image.target;
+    ResourceRegistry::get().add_ref(texture._handle);
+    if(image.span.data) {
+      this->_ring.upload(
+        image.span,
+        texture,
+        image.width,
+        image.height,
+        image.use_nearest,
+        image.use_mipmap,
+        image.texture_wrap,
+        image.channels
+      );
+    } else {
+      texture.load_from_data(
+        image.pixels.get(),
+        image.width,
+        image.height,
+        image.use_nearest,
+        image.use_mipmap,
+        image.texture_wrap,
+        image.channels
+      );
+    }
+    if(image.sampler) {
+      texture._set_sampler(*image.sampler);
+    }
+    uploaded_bytes += static_cast<std::size_t>(image.width) * image.height * image.channels;
+  }
+  return uploaded_bytes;
+}
+
+void AsyncTextureLoader::finish() noexcept {
+  {
+    std::unique_lock lock(this->_state->mutex);
+    this->_state->decoded.wait(lock, [this] {
+      return this->_state->decoding_count == 0;
+    });
+  }
+  this->update(std::numeric_limits<std::size_t>::max());
+}
+
+[[nodiscard]] std::size_t AsyncTextureLoader::get_pending_count() const noexcept {
+  std::lock_guard lock(this->_state->mutex);
+  return this->_state->decoding_count + this->_state->ready.size();
+}
+
+[[nodiscard]] std::size_t AsyncTextureLoader::get_ready_count() const noexcept {
+  std::lock_guard lock(this->_state->mutex);
+  return this->_state->ready.size();
+}
+
+[[nodiscard]] const PixelUploadRing& AsyncTextureLoader::get_upload_ring() const noexcept {
+  return this->_ring;
+}
+
+void AsyncTextureLoader::_enqueue(TextureHandle target,
+                                  const char* file_path,
+                                  bool use_nearest,
+                                  bool use_mipmap,
+                                  const Texture::WrapOptions& texture_wrap,
+                                  bool premultiply_alpha,
+                                  const std::optional<SamplerDesc>& sampler) noexcept {
+  {
+    std::lock_guard lock(this->_state->mutex);
+    ++this->_state->decoding_count;
+  }
+  DecodedImage image {
+    target, file_path, UploadSpan{nullptr, 0, 0}, nullptr, 0, 0, 0, use_nearest, use_mipmap, texture_wrap, sampler
+  };
+  // loader outlives the job (destructor waits), so ring pointer stays valid.
+  this->_workers.submit([state = this->_state, ring = &this->_ring, image = std::move(image), premultiply_alpha]() mutable {
+    // qoi is decoded straight into upload ring, no staging copy.
+    std::vector<std::uint8_t> qoi_bytes;
+    QoiHeader qoi_header;
+    if(read_qoi_file(image.file_path.c_str(), qoi_bytes)) {
+      if(read_qoi_header(qoi_bytes.data(), qoi_bytes.size(), qoi_header)) {
+        const auto size = static_cast<std::size_t>(qoi_header.width) * qoi_header.height * qoi_header.channels;
+        image.span = ring->allocate(size);
+        auto* destination = image.span.data;
+        if(!destination) {
+          image.pixels = std::shared_ptr<unsigned char>(new unsigned char[size], std::default_delete<unsigned char[]>());
+          destination = image.pixels.get();
+        }
+        if(decode_qoi(qoi_bytes.data(), qoi_bytes.size(), destination, qoi_header.channels, true)) {
+          if(premultiply_alpha) {
+            process_image(destination, destination, qoi_header.width, qoi_header.height, qoi_header.channels,
+                          ImageOps{false, true, false});
+          }
+          image.width = static_cast<GLsizei>(qoi_header.width);
+          image.height = static_cast<GLsizei>(qoi_header.height);
+          image.channels = qoi_header.channels;
+        } else {
+          ring->release(image.span);
+          image.span = UploadSpan{nullptr, 0, 0};
+          image.pixels.reset();
+        }
+      }
+    } else {
+      // flipped below, like Texture::load().
+      stbi_set_flip_vertically_on_load_thread(false);
+      int width { 0 }, height { 0 }, channels { 0 };
+      stbi_info(image.file_path.c_str(), &width, &height, &channels);
+      // grayscale (+ alpha) images are expanded; Texture only uploads RGB and RGBA.
+      const int desired_channels { channels == 3 ? 3 : 4 };
+      auto* pixels = stbi_load(image.file_path.c_str(), &width, &height, &channels, desired_channels);
+      if(pixels) {
+        image.width = width;
+        image.height = height;
+        image.channels = desired_channels;
+        const auto size = static_cast<std::size_t>(width) * height * desired_channels;
+        image.span = ring->allocate(size);
+        const ImageOps ops { true, premultiply_alpha, false };
+        if(image.span.data) {
+          // stb has no decode-into-destination api; flip (and premultiply)
+          // pass doubles as copy into ring, off render thread.
+          process_image(pixels, image.span.data, static_cast<std::uint32_t>(width),
+                        static_cast<std::uint32_t>(height), desired_channels, ops);
+          stbi_image_free(pixels);
+        } else {
+          process_image(pixels, pixels, static_cast<std::uint32_t>(width),
+                        static_cast<std::uint32_t>(height), desired_channels, ops);
+          image.pixels = std::shared_ptr<unsigned char>(pixels, stbi_image_free);
+        }
+      }
+    }
+    std::lock_guard lock(state->mutex);
+    state->ready.push_back(std::move(image));
+    --state->decoding_count;
+    state->decoded.notify_all();
+  });
+}
+} // namespace fre2d
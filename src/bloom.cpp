@@ -0,0 +1,176 @@
+// MIT License
+//
+// Copyright (c) 2025 Ferhat Geçdoğan All Rights Reserved.
+// Distributed under the terms of the MIT License.
+//
+#include <bloom.hpp>
+#include <algorithm>
+#include <cmath>
+
+namespace fre2d {
+Bloom::Bloom(RenderTargetPool& pool) noexcept
+  : _pool{pool},
+    _level_desc{{ColorRgba16f}, DepthStencilNone},
+    _threshold{detail::bloom::default_threshold},
+    _knee{detail::bloom::default_knee},
+    _intensity{detail::bloom::default_intensity} {
+  this->set_radius(detail::bloom::default_radius);
+}
+
+void Bloom::set_radius(GLfloat radius) noexcept {
+  this->_radius = std::max(radius, 1.f);
+  // each level doubles the footprint of kernel; offset covers the rest.
+  this->_level_count = std::clamp<std::size_t>(
+    static_cast<std::size_t>(std::floor(std::log2(this->_radius))),
+    1,
+    detail::bloom::max_levels
+  );
+  this->_offset = std::clamp(
+    this->_radius / static_cast<GLfloat>(1u << this->_level_count),
+    0.5f,
+    2.f
+  );
+}
+
+void Bloom::set_threshold(GLfloat threshold, GLfloat knee) noexcept {
+  this->_threshold = threshold;
+  this->_knee = knee;
+}
+
+void Bloom::set_intensity(GLfloat intensity) noexcept {
+  this->_intensity = intensity;
+}
+
+void Bloom::blur(Framebuffer& input, Framebuffer* output) noexcept {
+  this->_initialize_shaders();
+  auto& blurred = this->_run_chain(input, false);
+  // last upsample goes straight into output at full resolution.
+  this->_draw_pass(blurred, output, this->_upsample_shader, input.get_width(), input.get_height());
+  this->_release_levels();
+}
+
+void Bloom::apply(Framebuffer& input, Framebuffer* output) noexcept {
+  this->_initialize_shaders();
+  auto& blurred = this->_run_chain(input, true);
+  // render_texture() binds additional textures of input; keep bloom above them.
+  GLint bloom_unit { detail::bloom::bloom_texture_unit };
+  for(const auto& info: input.get_additional_textures()) {
+    bloom_unit = std::max(bloom_unit, info.sampler_id + 1);
+  }
+  blurred.get_color_buffer().bind(bloom_unit);
+  this->_composite_shader.set_int("BloomTexture", bloom_unit);
+  this->_composite_shader.set_float("Intensity", this->_intensity);
+  this->_composite_shader.set_float_vec2("BloomTexCoordsScale", glm::vec2 {
+    static_cast<GLfloat>(blurred.get_width()) / static_cast<GLfloat>(blurred.get_capacity_width()),
+    static_cast<GLfloat>(blurred.get_height()) / static_cast<GLfloat>(blurred.get_capacity_height())
+  });
+  if(output) {
+    output->call([&] {
+      input.render_texture(this->_composite_shader);
+    });
+  } else {
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glViewport(0, 0, input.get_width(), input.get_height());
+    input.render_texture(this->_composite_shader);
+  }
+  this->_release_levels();
+}
+
+[[nodiscard]] const GLfloat& Bloom::get_radius() const noexcept {
+  return this->_radius;
+}
+
+[[nodiscard]] const GLfloat& Bloom::get_threshold() const noexcept {
+  return this->_threshold;
+}
+
+[[nodiscard]] const GLfloat& Bloom::get_knee() const noexcept {
+  return this->_knee;
+}
+
+[[nodiscard]] const GLfloat& Bloom::get_intensity() const noexcept {
+  return this->_intensity;
+}
+
+[[nodiscard]] const std::size_t& Bloom::get_level_count() const noexcept {
+  return this->_level_count;
+}
+
+void Bloom::_initialize_shaders() noexcept {
+  if(this->_downsample_shader.get_program_id() != 0) {
+    return;
+  }
+  this->_downsample_shader.initialize(detail::framebuffer::default_vertex, detail::bloom::downsample_fragment);
+  this->_upsample_shader.initialize(detail::framebuffer::default_vertex, detail::bloom::upsample_fragment);
+  this->_composite_shader.initialize(detail::bloom::composite_vertex, detail::bloom::composite_fragment);
+  this->_downsample_shader.set_int("ScreenTexture", 0);
+  this->_upsample_shader.set_int("ScreenTexture", 0);
+  this->_composite_shader.set_int("ScreenTexture", 0);
+}
+
+Framebuffer& Bloom::_run_chain(Framebuffer& input, bool prefilter) noexcept {
+  this->_levels.clear();
+  for(std::size_t level = 1; level <= this->_level_count; ++level) {
+    const auto width = std::max(input.get_width() >> level, 1);
+    const auto height = std::max(input.get_height() >> level, 1);
+    this->_levels.push_back(&this->_pool.acquire(width, height, this->_level_desc));
+    if(width == 1 && height == 1) {
+      break; // no point going further.
+    }
+  }
+
+  // levels are pooled RGBA16F targets that keep previous frame's glow; with
+  // app's blending on, passes would accumulate over it. so they overwrite,
+  // and app's blend state is restored for pass into output.
+  const bool blend_enabled { glIsEnabled(GL_BLEND) == GL_TRUE };
+  glDisable(GL_BLEND);
+
+  this->_downsample_shader.set_bool("Prefilter", prefilter);
+  this->_downsample_shader.set_float("Threshold", this->_threshold);
+  this->_downsample_shader.set_float("Knee", this->_knee);
+  Framebuffer* source { &input };
+  for(auto* level: this->_levels) {
+    this->_draw_pass(*source, level, this->_downsample_shader, level->get_width(), level->get_height());
+    if(source == &input) {
+      this->_downsample_shader.set_bool("Prefilter", false);
+    }
+    source = level;
+  }
+
+  for(std::size_t level = this->_levels.size() - 1; level > 0; --level) {
+    auto* target = this->_levels[level - 1];
+    this->_draw_pass(*this->_levels[level], target, this->_upsample_shader, target->get_width(), target->get_height());
+  }
+  if(blend_enabled) {
+    glEnable(GL_BLEND);
+  }
+  return *this->_levels.front();
+}
+
+void Bloom::_draw_pass(Framebuffer& source, Framebuffer* target, const Shader& shader, GLsizei width, GLsizei height) const noexcept {
+  const auto capacity_width = static_cast<GLfloat>(source.get_capacity_width());
+  const auto capacity_height = static_cast<GLfloat>(source.get_capacity_height());
+  shader.set_float("Offset", this->_offset);
+  shader.set_float_vec2("TexelSize", glm::vec2 { 1.f / capacity_width, 1.f / capacity_height });
+  shader.set_float_vec2("UvMax", glm::vec2 {
+    (static_cast<GLfloat>(source.get_width()) - 0.5f) / capacity_width,
+    (static_cast<GLfloat>(source.get_height()) - 0.5f) / capacity_height
+  });
+  if(target) {
+    target->call([&] {
+      source.render_texture(shader);
+    });
+  } else {
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glViewport(0, 0, width, height);
+    source.render_texture(shader);
+  }
+}
+
+void Bloom::_release_levels() noexcept {
+  for(auto* level: this->_levels) {
+    this->_pool.release(*level);
+  }
+  this->_levels.clear();
+}
+} // namespace fre2d
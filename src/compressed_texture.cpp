@@ -0,0 +1,492 @@
+// MIT License
+//
+// Copyright (c) 2025 Ferhat Geçdoğan All Rights Reserved.
+// Distributed under the terms of the MIT License.
+//
+#include <compressed_texture.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+
+namespace fre2d {
+namespace {
+using Block = std::array<std::array<int, 4>, 16>; // 4x4 RGBA pixels
+
+[[nodiscard]] int squared_distance(const std::array<int, 4>& lhs, const std::array<int, 4>& rhs, int channels) noexcept {
+  int distance { 0 };
+  for(int c = 0; c < channels; ++c) {
+    distance += (lhs[c] - rhs[c]) * (lhs[c] - rhs[c]);
+  }
+  return distance;
+}
+
+// bounding box of block, with diagonal flipped per channel if it
+// correlates negatively with channel that has largest range; cheap
+// replacement of principal axis that works well for 4x4 blocks.
+void find_endpoints(const Block& block,
+                    const std::array<bool, 16>& used,
+                    int channels,
+                    std::array<int, 4>& low,
+                    std::array<int, 4>& high) noexcept {
+  low = { 255, 255, 255, 255 };
+  high = { 0, 0, 0, 0 };
+  std::array<int, 4> sum { 0, 0, 0, 0 };
+  int count { 0 };
+  for(std::size_t i = 0; i < 16; ++i) {
+    if(!used[i]) {
+      continue;
+    }
+    for(int c = 0; c < channels; ++c) {
+      low[c] = std::min(low[c], block[i][c]);
+      high[c] = std::max(high[c], block[i][c]);
+      sum[c] += block[i][c];
+    }
+    ++count;
+  }
+  if(count == 0) {
+    low = high = { 0, 0, 0, 0 };
+    return;
+  }
+  int main_channel { 0 };
+  for(int c = 1; c < channels; ++c) {
+    if(high[c] - low[c] > high[main_channel] - low[main_channel]) {
+      main_channel = c;
+    }
+  }
+  for(int c = 0; c < channels; ++c) {
+    if(c == main_channel) {
+      continue;
+    }
+    long covariance { 0 };
+    for(std::size_t i = 0; i < 16; ++i) {
+      if(used[i]) {
+        covariance += static_cast<long>(block[i][c] * count - sum[c]) * (block[i][main_channel] * count - sum[main_channel]);
+      }
+    }
+    if(covariance < 0) {
+      std::swap(low[c], high[c]);
+    }
+  }
+}
+
+[[nodiscard]] std::uint16_t to_565(const std::array<int, 4>& color) noexcept {
+  return static_cast<std::uint16_t>(((color[0] >> 3) << 11) | ((color[1] >> 2) << 5) | (color[2] >> 3));
+}
+
+[[nodiscard]] std::array<int, 4> from_565(std::uint16_t value) noexcept {
+  const int r { (value >> 11) & 31 }, g { (value >> 5) & 63 }, b { value & 31 };
+  return { (r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2), 255 };
+}
+
+void write_u16(std::uint8_t* out, std::uint16_t value) noexcept {
+  out[0] = static_cast<std::uint8_t>(value);
+  out[1] = static_cast<std::uint8_t>(value >> 8);
+}
+
+// 4-color (or 3-color + transparent if allow_alpha and block has alpha < 128) color block.
+void encode_bc1(const Block& block, bool allow_alpha, std::uint8_t* out) noexcept {
+  std::array<bool, 16> used;
+  bool has_transparent { false };
+  for(std::size_t i = 0; i < 16; ++i) {
+    used[i] = !allow_alpha || block[i][3] >= 128;
+    has_transparent = has_transparent || !used[i];
+  }
+  std::array<int, 4> low, high;
+  find_endpoints(block, used, 3, low, high);
+  // inset by 1/16 of range; extremes are rarely hit exactly after rounding to 565.
+  for(int c = 0; c < 3; ++c) {
+    const int inset { (high[c] - low[c]) / 16 };
+    high[c] -= inset;
+    low[c] += inset;
+  }
+  auto c0 = to_565(high), c1 = to_565(low);
+  // c0 > c1 selects 4-color mode, c0 <= c1 3-color mode with transparent index 3.
+  if((has_transparent && c0 > c1) || (!has_transparent && c0 < c1)) {
+    std::swap(c0, c1);
+  }
+  const auto e0 = from_565(c0), e1 = from_565(c1);
+  std::array<std::array<int, 4>, 4> palette { e0, e1 };
+  std::size_t palette_size { 4 };
+  if(c0 > c1) {
+    for(int c = 0; c < 3; ++c) {
+      palette[2][c] = (2 * e0[c] + e1[c]) / 3;
+      palette[3][c] = (e0[c] + 2 * e1[c]) / 3;
+    }
+  } else {
+    for(int c = 0; c < 3; ++c) {
+      palette[2][c] = (e0[c] + e1[c]) / 2;
+    }
+    palette_size = 3; // 3 is transparent black.
+  }
+
+  std::uint32_t indices { 0 };
+  for(std::size_t i = 0; i < 16; ++i) {
+    std::uint32_t best { 3 };
+    if(used[i]) {
+      int best_distance { std::numeric_limits<int>::max() };
+      for(std::size_t p = 0; p < palette_size; ++p) {
+        const int distance { squared_distance(block[i], palette[p], 3) };
+        if(distance < best_distance) {
+          best_distance = distance;
+          best = static_cast<std::uint32_t>(p);
+        }
+      }
+    }
+    indices |= best << (i * 2);
+  }
+  write_u16(out, c0);
+  write_u16(out + 2, c1);
+  for(int i = 0; i < 4; ++i) {
+    out[4 + i] = static_cast<std::uint8_t>(indices >> (i * 8));
+  }
+}
+
+// 8-value mode of single channel block (BC4, alpha of BC3).
+void encode_bc4(const Block& block, int channel, std::uint8_t* out) noexcept {
+  int low { 255 }, high { 0 };
+  for(const auto& pixel: block) {
+    low = std::min(low, pixel[channel]);
+    high = std::max(high, pixel[channel]);
+  }
+  std::array<int, 8> palette { high, low };
+  for(int i = 2; i < 8; ++i) {
+    palette[i] = ((8 - i) * high + (i - 1) * low) / 7;
+  }
+  std::uint64_t indices { 0 };
+  if(high != low) {
+    for(std::size_t i = 0; i < 16; ++i) {
+      std::uint64_t best { 0 };
+      int best_distance { std::numeric_limits<int>::max() };
+      for(std::size_t p = 0; p < 8; ++p) {
+        const int distance { std::abs(block[i][channel] - palette[p]) };
+        if(distance < best_distance) {
+          best_distance = distance;
+          best = p;
+        }
+      }
+      indices |= best << (i * 3);
+    }
+  }
+  out[0] = static_cast<std::uint8_t>(high);
+  out[1] = static_cast<std::uint8_t>(low);
+  for(int i = 0; i < 6; ++i) {
+    out[2 + i] = static_cast<std::uint8_t>(indices >> (i * 8));
+  }
+}
+
+class BitWriter {
+public:
+  explicit BitWriter(std::uint8_t* out) noexcept : _out{out} {
+    std::memset(out, 0, 16);
+  }
+
+  void write(std::uint32_t value, int bits) noexcept {
+    for(int i = 0; i < bits; ++i, ++this->_position) {
+      if((value >> i) & 1u) {
+        this->_out[this->_position / 8] |= static_cast<std::uint8_t>(1u << (this->_position % 8));
+      }
+    }
+  }
+private:
+  std::uint8_t* _out;
+  int _position { 0 };
+};
+
+struct Bc7Candidate {
+  std::array<std::array<int, 4>, 2> quantized; // 7-bit endpoints.
+  std::array<int, 2> p_bits;
+  std::array<std::uint32_t, 16> indices;
+  int error;
+};
+
+static constexpr std::array<int, 16> bc7_weights { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+// quantizes endpoints (p-bit is lowest bit of every channel, picked by
+// error) and finds nearest index of every pixel.
+[[nodiscard]] Bc7Candidate make_bc7_candidate(const Block& block, const std::array<std::array<int, 4>, 2>& endpoints) noexcept {
+  Bc7Candidate candidate;
+  for(std::size_t e = 0; e < 2; ++e) {
+    int best_error { std::numeric_limits<int>::max() };
+    for(int p = 0; p < 2; ++p) {
+      std::array<int, 4> quantized;
+      int error { 0 };
+      for(int c = 0; c < 4; ++c) {
+        quantized[c] = std::clamp((endpoints[e][c] - p + 1) / 2, 0, 127);
+        const int restored { quantized[c] * 2 + p };
+        error += (restored - endpoints[e][c]) * (restored - endpoints[e][c]);
+      }
+      if(error < best_error) {
+        best_error = error;
+        candidate.quantized[e] = quantized;
+        candidate.p_bits[e] = p;
+      }
+    }
+  }
+
+  std::array<std::array<int, 4>, 16> palette;
+  for(std::size_t i = 0; i < 16; ++i) {
+    for(int c = 0; c < 4; ++c) {
+      const int e0 { candidate.quantized[0][c] * 2 + candidate.p_bits[0] };
+      const int e1 { candidate.quantized[1][c] * 2 + candidate.p_bits[1] };
+      palette[i][c] = ((64 - bc7_weights[i]) * e0 + bc7_weights[i] * e1 + 32) >> 6;
+    }
+  }
+  candidate.error = 0;
+  for(std::size_t i = 0; i < 16; ++i) {
+    int best_distance { std::numeric_limits<int>::max() };
+    for(std::size_t p = 0; p < 16; ++p) {
+      const int distance { squared_distance(block[i], palette[p], 4) };
+      if(distance < best_distance) {
+        best_distance = distance;
+        candidate.indices[i] = static_cast<std::uint32_t>(p);
+      }
+    }
+    candidate.error += best_distance;
+  }
+  return candidate;
+}
+
+// least squares endpoints for weights of given indices; false if every
+// pixel uses same weight.
+[[nodiscard]] bool refit_bc7_endpoints(const Block& block,
+                                       const Bc7Candidate& candidate,
+                                       std::array<std::array<int, 4>, 2>& endpoints) noexcept {
+  double aa { 0.0 }, ab { 0.0 }, bb { 0.0 };
+  std::array<double, 4> ax { 0.0, 0.0, 0.0, 0.0 }, bx { 0.0, 0.0, 0.0, 0.0 };
+  for(std::size_t i = 0; i < 16; ++i) {
+    const double t { bc7_weights[candidate.indices[i]] / 64.0 };
+    aa += (1.0 - t) * (1.0 - t);
+    ab += (1.0 - t) * t;
+    bb += t * t;
+    for(int c = 0; c < 4; ++c) {
+      ax[c] += (1.0 - t) * block[i][c];
+      bx[c] += t * block[i][c];
+    }
+  }
+  const double determinant { aa * bb - ab * ab };
+  if(std::abs(determinant) < 1e-6) {
+    return false;
+  }
+  for(int c = 0; c < 4; ++c) {
+    endpoints[0][c] = std::clamp(static_cast<int>(std::lround((ax[c] * bb - bx[c] * ab) / determinant)), 0, 255);
+    endpoints[1][c] = std::clamp(static_cast<int>(std::lround((bx[c] * aa - ax[c] * ab) / determinant)), 0, 255);
+  }
+  return true;
+}
+
+// mode 6 only: one subset, 7-bit RGBA endpoints + p-bit, 4-bit indices.
+// not as good as searching every mode, but 16 levels per channel beat BC1/BC3
+// on gradients; alpha shares interpolation line with color though.
+void encode_bc7(const Block& block, std::uint8_t* out) noexcept {
+  std::array<bool, 16> used;
+  used.fill(true);
+  std::array<std::array<int, 4>, 2> endpoints;
+  find_endpoints(block, used, 4, endpoints[0], endpoints[1]);
+  auto best = make_bc7_candidate(block, endpoints);
+  for(int iteration = 0; iteration < 2 && best.error > 0; ++iteration) {
+    if(!refit_bc7_endpoints(block, best, endpoints)) {
+      break;
+    }
+    const auto refined = make_bc7_candidate(block, endpoints);
+    if(refined.error >= best.error) {
+      break;
+    }
+    best = refined;
+  }
+
+  // first index is stored with 3 bits, so its top bit must be 0;
+  // weights are symmetric, so swapping endpoints mirrors indices.
+  if(best.indices[0] >= 8) {
+    std::swap(best.quantized[0], best.quantized[1]);
+    std::swap(best.p_bits[0], best.p_bits[1]);
+    for(auto& index: best.indices) {
+      index = 15 - index;
+    }
+  }
+
+  BitWriter writer(out);
+  writer.write(1u << 6, 7); // mode 6
+  for(int c = 0; c < 4; ++c) {
+    writer.write(static_cast<std::uint32_t>(best.quantized[0][c]), 7);
+    writer.write(static_cast<std::uint32_t>(best.quantized[1][c]), 7);
+  }
+  writer.write(static_cast<std::uint32_t>(best.p_bits[0]), 1);
+  writer.write(static_cast<std::uint32_t>(best.p_bits[1]), 1);
+  writer.write(best.indices[0], 3);
+  for(std::size_t i = 1; i < 16; ++i) {
+    writer.write(best.indices[i], 4);
+  }
+}
+
+[[nodiscard]] std::uint32_t read_u32(const std::uint8_t* data) noexcept {
+  return static_cast<std::uint32_t>(data[0]) | (static_cast<std::uint32_t>(data[1]) << 8) |
+         (static_cast<std::uint32_t>(data[2]) << 16) | (static_cast<std::uint32_t>(data[3]) << 24);
+}
+
+void append_u32(std::vector<std::uint8_t>& out, std::uint32_t value) {
+  for(int i = 0; i < 4; ++i) {
+    out.push_back(static_cast<std::uint8_t>(value >> (i * 8)));
+  }
+}
+} // anonymous namespace
+
+[[nodiscard]] GLenum get_block_format_internal_format(BlockFormat format) noexcept {
+  switch(format) {
+  case BlockFormatBc1: { return detail::compressed_texture::compressed_rgba_s3tc_dxt1; }
+  case BlockFormatBc3: { return detail::compressed_texture::compressed_rgba_s3tc_dxt5; }
+  case BlockFormatBc4: { return GL_COMPRESSED_RED_RGTC1; }
+  default: { return GL_COMPRESSED_RGBA_BPTC_UNORM; }
+  }
+}
+
+[[nodiscard]] std::size_t get_block_format_block_bytes(BlockFormat format) noexcept {
+  return format == BlockFormatBc1 || format == BlockFormatBc4 ? 8 : 16;
+}
+
+[[nodiscard]] const char* get_block_format_name(BlockFormat format) noexcept {
+  switch(format) {
+  case BlockFormatBc1: { return "BC1"; }
+  case BlockFormatBc3: { return "BC3"; }
+  case BlockFormatBc4: { return "BC4"; }
+  default: { return "BC7"; }
+  }
+}
+
+[[nodiscard]] bool is_block_format_supported(BlockFormat format) noexcept {
+  if(format == BlockFormatBc4 || format == BlockFormatBc7) {
+    return true; // core since 3.0 and 4.2.
+  }
+  static const bool s3tc_supported = [] {
+    GLint count { 0 };
+    glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+    for(GLint i = 0; i < count; ++i) {
+      const auto* name = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, i));
+      if(name && std::strcmp(name, "GL_EXT_texture_compression_s3tc") == 0) {
+        return true;
+      }
+    }
+    return false;
+  }();
+  return s3tc_supported;
+}
+
+void encode_block_rows(BlockFormat format,
+                       const std::uint8_t* rgba,
+                       std::uint32_t width,
+                       std::uint32_t height,
+                       std::uint32_t first_block_row,
+                       std::uint32_t last_block_row,
+                       std::uint8_t* blocks) noexcept {
+  constexpr auto dimension = detail::compressed_texture::block_dimension;
+  const std::uint32_t blocks_x { (width + dimension - 1) / dimension };
+  const auto block_bytes = get_block_format_block_bytes(format);
+  Block block;
+  for(std::uint32_t block_y = first_block_row; block_y < last_block_row; ++block_y) {
+    for(std::uint32_t block_x = 0; block_x < blocks_x; ++block_x) {
+      for(std::uint32_t y = 0; y < dimension; ++y) {
+        const auto source_y = std::min(block_y * dimension + y, height - 1);
+        for(std::uint32_t x = 0; x < dimension; ++x) {
+          const auto source_x = std::min(block_x * dimension + x, width - 1);
+          const auto* pixel = rgba + (static_cast<std::size_t>(source_y) * width + source_x) * 4;
+          block[y * dimension + x] = { pixel[0], pixel[1], pixel[2], pixel[3] };
+        }
+      }
+      auto* out = blocks + (static_cast<std::size_t>(block_y) * blocks_x + block_x) * block_bytes;
+      switch(format) {
+      case BlockFormatBc1: { encode_bc1(block, true, out); break; }
+      case BlockFormatBc3: {
+        encode_bc4(block, 3, out);
+        encode_bc1(block, false, out + 8);
+        break;
+      }
+      case BlockFormatBc4: { encode_bc4(block, 0, out); break; }
+      default: { encode_bc7(block, out); break; }
+      }
+    }
+  }
+}
+
+[[nodiscard]] std::size_t get_compressed_level_size(BlockFormat format, std::uint32_t width, std::uint32_t height) noexcept {
+  constexpr auto dimension = detail::compressed_texture::block_dimension;
+  return static_cast<std::size_t>((width + dimension - 1) / dimension) *
+         ((height + dimension - 1) / dimension) * get_block_format_block_bytes(format);
+}
+
+[[nodiscard]] std::vector<std::uint8_t> write_compressed_texture(const CompressedImage& image) noexcept {
+  std::vector<std::uint8_t> out(detail::compressed_texture::magic.begin(), detail::compressed_texture::magic.end());
+  append_u32(out, detail::compressed_texture::version);
+  append_u32(out, image.format);
+  append_u32(out, image.levels.empty() ? 0 : image.levels.front().width);
+  append_u32(out, image.levels.empty() ? 0 : image.levels.front().height);
+  append_u32(out, static_cast<std::uint32_t>(image.levels.size()));
+  for(const auto& level: image.levels) {
+    append_u32(out, static_cast<std::uint32_t>(level.blocks.size()));
+    out.insert(out.end(), level.blocks.begin(), level.blocks.end());
+  }
+  return out;
+}
+
+[[nodiscard]] bool read_compressed_texture_levels(const std::uint8_t* data,
+                                                  std::size_t size,
+                                                  BlockFormat& format,
+                                                  std::vector<CompressedLevelView>& levels) noexcept {
+  const auto fail = [](const char* reason) {
+    std::cout << "fre2d error: read_compressed_texture(): " << reason << ".\n";
+    return false;
+  };
+  if(!data || size < detail::compressed_texture::header_size ||
+     !std::equal(detail::compressed_texture::magic.begin(), detail::compressed_texture::magic.end(), data)) {
+    return fail("not a .f2tc file");
+  }
+  if(read_u32(data + 4) != detail::compressed_texture::version) {
+    return fail("unsupported version");
+  }
+  const auto format_value = read_u32(data + 8);
+  if(format_value > BlockFormatBc7) {
+    return fail("unknown block format");
+  }
+  format = static_cast<BlockFormat>(format_value);
+  std::uint32_t width { read_u32(data + 12) }, height { read_u32(data + 16) };
+  const auto level_count = read_u32(data + 20);
+  if(width == 0 || height == 0 || level_count == 0 || level_count > 32) {
+    return fail("invalid dimensions");
+  }
+
+  levels.clear();
+  std::size_t offset { detail::compressed_texture::header_size };
+  for(std::uint32_t level = 0; level < level_count; ++level) {
+    if(offset + 4 > size) {
+      return fail("truncated file");
+    }
+    const auto level_size = read_u32(data + offset);
+    offset += 4;
+    if(level_size != get_compressed_level_size(format, width, height) || offset + level_size > size) {
+      return fail("invalid level size");
+    }
+    levels.push_back(CompressedLevelView{ width, height, data + offset, level_size });
+    offset += level_size;
+    width = std::max(width / 2, 1u);
+    height = std::max(height / 2, 1u);
+  }
+  return true;
+}
+
+[[nodiscard]] bool read_compressed_texture(const std::uint8_t* data, std::size_t size, CompressedImage& image) noexcept {
+  std::vector<CompressedLevelView> views;
+  if(!read_compressed_texture_levels(data, size, image.format, views)) {
+    return false;
+  }
+  image.levels.clear();
+  for(const auto& view: views) {
+    image.levels.push_back(CompressedLevel{
+      view.width,
+      view.height,
+      std::vector<std::uint8_t>(view.blocks, view.blocks + view.size)
+    });
+  }
+  return true;
+}
+} // namespace fre2d
@@ -19,7 +19,8 @@ Drawable::Drawable() noexcept
     _ignore_zoom{detail::drawable::default_ignore_zoom},
     _flip_vertically{detail::drawable::default_flip_vertically},
     _flip_horizontally{detail::drawable::default_flip_horizontally},
-    _relative_pos{0.f, 0.f} {
+    _relative_pos{0.f, 0.f},
+    _emissive{detail::drawable::default_emissive} {
 }
 
 Drawable::Drawable(
@@ -29,7 +30,8 @@ Drawable::Drawable(
   bool flip_vertically,
   bool flip_horizontally
 ) noexcept
-  : _relative_pos{0.f, 0.f} {
+  : _relative_pos{0.f, 0.f},
+    _emissive{detail::drawable::default_emissive} {
   this->initialize_drawable(
     scale,
     position,
@@ -75,6 +77,10 @@ void Drawable::set_affected_by_light(bool affected_by_light) noexcept {
   this->_affected_by_light = affected_by_light;
 }
 
+void Drawable::set_emissive(GLfloat emissive) noexcept {
+  this->_emissive = emissive;
+}
+
 [[nodiscard]] const glm::vec2& Drawable::get_position() const noexcept {
   return this->_position;
 }
@@ -138,6 +144,10 @@ void Drawable::set_affected_by_light(bool affected_by_light) noexcept {
   return this->_affected_by_light;
 }
 
+[[nodiscard]] const GLfloat& Drawable::get_emissive() const noexcept {
+  return this->_emissive;
+}
+
 [[nodiscard]] glm::mat4
 Drawable::get_model_matrix_custom(const glm::vec3 &scale,
                                   const glm::vec2 &position,
@@ -201,6 +211,8 @@ void Drawable::before_draw(const Shader &shader,
   shader.set_bool("FlipVertically", this->_flip_vertically);
   shader.set_bool("FlipHorizontally", this->_flip_horizontally);
   shader.set_bool("AffectedByLight", this->_affected_by_light);
+  shader.set_float("Emissive", this->_emissive);
+  shader.set_bool("PremultipliedAlpha", Renderer::get_blend_mode() == BlendModePremultiplied);
   this->before_draw_custom(shader, cam, lm);
   lm->get_point_lights_ssbo().bind();
   lm->update_buffers();
@@ -210,7 +222,7 @@ void Drawable::before_draw(const Shader &shader,
   if (!this->get_mesh().get_texture().has_value()) {
     Texture::get_default_texture().bind(0);
   } else {
-    this->get_mesh().get_texture()->bind(0);
+    Texture::bind(*this->get_mesh().get_texture(), 0);
   }
   this->get_mesh().get_vao().unbind();
 }
@@ -5,24 +5,23 @@
 //
 #include <element_buffer.hpp>
 #include <error.hpp>
+#include <gpu_memory_tracker.hpp>
 
 namespace fre2d {
 ElementBuffer::ElementBuffer(const std::vector<GLuint>& indices, bool initialize) noexcept
-  : _ebo_id{0}, _indices_count{0} {
+  : _indices_count{0} {
   if(initialize) {
     this->initialize(indices);
   }
 }
 
 ElementBuffer::~ElementBuffer() noexcept {
-  if(this->get_ebo_id() != 0) {
-    this->unbind();
-    glDeleteBuffers(1, &this->_ebo_id);
-  }
+  // deleted by ResourceRegistry; copies do not delete it twice.
+  ResourceRegistry::get().destroy(this->_handle);
 }
 
 void ElementBuffer::bind() const noexcept {
-  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, this->_ebo_id);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, this->get_ebo_id());
 }
 
 void ElementBuffer::unbind() const noexcept {
@@ -30,14 +29,17 @@ void ElementBuffer::unbind() const noexcept {
 }
 
 void ElementBuffer::initialize(const std::vector<GLuint> &indices) noexcept {
-  glGenBuffers(1, &this->_ebo_id);
-  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, this->_ebo_id);
+  GLuint ebo_id { 0 };
+  glGenBuffers(1, &ebo_id);
+  ResourceRegistry::get().assign(this->_handle, ebo_id);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo_id);
   glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(GLuint), indices.data(), GL_STATIC_DRAW);
+  GpuMemoryTracker::get().track(GpuMemoryClassElementBuffer, this->_handle.value, indices.size() * sizeof(GLuint));
   this->_indices_count = static_cast<GLsizei>(indices.size());
 }
 
-[[nodiscard]] const GLuint& ElementBuffer::get_ebo_id() const noexcept {
-  return this->_ebo_id;
+[[nodiscard]] GLuint ElementBuffer::get_ebo_id() const noexcept {
+  return ResourceRegistry::get().get_name(this->_handle);
 }
 
 [[nodiscard]] const GLsizei& ElementBuffer::get_indices_count() const noexcept {
@@ -1,4 +1,5 @@
 #include <font.hpp>
+#include <asset_pack.hpp>
 #include <iostream>
 
 namespace fre2d {
@@ -7,8 +8,14 @@ Font::Font(const FontManager &font_manager, const char *font_path,
   this->initialize_font(font_manager, font_path, font_size);
 }
 
+Font::Font(const FontManager& font_manager, const AssetPack& pack, std::string_view name,
+           FT_UInt font_size) noexcept {
+  this->initialize_font(font_manager, pack, name, font_size);
+}
+
 Font::~Font() noexcept {
   if(this->_face) {
+    std::lock_guard lock(FontManager::get_library_mutex());
     FT_Done_Face(this->_face);
   }
 }
@@ -18,10 +25,41 @@ void Font::initialize_font(const FontManager &font_manager, const char *font_pat
     font_manager.initialize();
   }
   this->_font_size = font_size;
-  if(FT_New_Face(fre2d::FontManager::ft, font_path, 0, &this->_face) != 0) {
-    std::cout << "error: Font::initialize(): failed to load font " << font_path << '\n';
+  {
+    // glyphs are loaded from our own face afterwards, which needs no lock.
+    std::lock_guard lock(FontManager::get_library_mutex());
+    if(FT_New_Face(fre2d::FontManager::ft, font_path, 0, &this->_face) != 0) {
+      this->_face = nullptr;
+      std::cout << "error: Font::initialize(): failed to load font " << font_path << '\n';
+      return;
+    }
+  }
+  this->_load_characters();
+}
+
+void Font::initialize_font(const FontManager& font_manager, const AssetPack& pack, std::string_view name, FT_UInt font_size) {
+  if(!fre2d::FontManager::is_initialized()) {
+    font_manager.initialize();
+  }
+  this->_font_size = font_size;
+  const auto entry = pack.find(name);
+  if(!entry || entry->type != AssetTypeFont) {
+    std::cout << "error: Font::initialize(): no font named " << name << " in asset pack\n";
     return;
   }
+  {
+    // FreeType reads from mapped pack; no copy of font file is made.
+    std::lock_guard lock(FontManager::get_library_mutex());
+    if(FT_New_Memory_Face(fre2d::FontManager::ft, entry->data, static_cast<FT_Long>(entry->size), 0, &this->_face) != 0) {
+      this->_face = nullptr;
+      std::cout << "error: Font::initialize(): failed to load font " << name << " from asset pack\n";
+      return;
+    }
+  }
+  this->_load_characters();
+}
+
+void Font::_load_characters() {
   FT_Set_Pixel_Sizes(this->_face, 0, this->_font_size);
   glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
   // TODO: this only loads extended ASCII characters. use dynamic loader,
@@ -18,6 +18,7 @@ FontManager::FontManager(bool initialize_now) noexcept {
 FontManager::~FontManager() noexcept {
   if(FontManager::ft) {
     FT_Done_FreeType(FontManager::ft);
+    FontManager::ft = nullptr;
   }
 }
 
@@ -37,4 +38,9 @@ void FontManager::initialize() const noexcept {
 [[nodiscard]] bool FontManager::is_initialized() noexcept {
   return FontManager::ft != nullptr;
 }
+
+[[nodiscard]] std::mutex& FontManager::get_library_mutex() noexcept {
+  static std::mutex library_mutex;
+  return library_mutex;
+}
 } // namespace fre2d
\ No newline at end of file
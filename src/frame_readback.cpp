@@ -0,0 +1,156 @@
+// MIT License
+//
+// Copyright (c) 2025 Ferhat Geçdoğan All Rights Reserved.
+// Distributed under the terms of the MIT License.
+//
+#include <frame_readback.hpp>
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <limits>
+
+namespace fre2d {
+FrameReadback::FrameReadback(ReadbackCallback callback,
+                             ThreadPool* workers,
+                             std::size_t ring_size) noexcept
+  : _callback{std::move(callback)},
+    _workers{workers},
+    _slots(std::max<std::size_t>(ring_size, 1), Slot{0, 0, nullptr, 0, 0, 0}),
+    _next_slot{0},
+    _pending_count{0},
+    _captured_count{0},
+    _dropped_count{0} {}
+
+FrameReadback::~FrameReadback() noexcept {
+  for(auto& slot: this->_slots) {
+    if(slot.fence) {
+      glDeleteSync(slot.fence);
+    }
+    if(slot.pbo_id != 0) {
+      glDeleteBuffers(1, &slot.pbo_id);
+    }
+  }
+}
+
+bool FrameReadback::capture(const Framebuffer& fb, std::size_t color_buffer_index) noexcept {
+  if(fb.get_fbo_id() == 0 || color_buffer_index >= fb.get_color_buffer_count()) {
+    std::cout << "fre2d error: FrameReadback::capture(): framebuffer has no color buffer "
+              << color_buffer_index << ".\n";
+    return false;
+  }
+  if(this->_pending_count == this->_slots.size()) {
+    // waiting here would stall exactly like glReadPixels does.
+    ++this->_dropped_count;
+    return false;
+  }
+
+  auto& slot = this->_slots[this->_next_slot];
+  const auto size = static_cast<GLsizeiptr>(fb.get_width()) * fb.get_height() * detail::frame_readback::bytes_per_pixel;
+  if(slot.pbo_id == 0) {
+    glCreateBuffers(1, &slot.pbo_id);
+  }
+  if(slot.capacity < size) {
+    glNamedBufferData(slot.pbo_id, size, nullptr, GL_STREAM_READ);
+    slot.capacity = size;
+  }
+
+  // copy is queued like any other command; offset 0 in bound pack buffer
+  // instead of client pointer. only rendered sub-rectangle is read.
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.pbo_id);
+  glGetTextureSubImage(
+    fb.get_color_buffer(color_buffer_index).get_texture_id(),
+    0,
+    0, 0, 0,
+    fb.get_width(), fb.get_height(), 1,
+    GL_RGBA,
+    GL_UNSIGNED_BYTE,
+    static_cast<GLsizei>(size),
+    nullptr
+  );
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+  slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  slot.frame_index = this->_captured_count++;
+  slot.width = fb.get_width();
+  slot.height = fb.get_height();
+
+  this->_next_slot = (this->_next_slot + 1) % this->_slots.size();
+  ++this->_pending_count;
+  return true;
+}
+
+void FrameReadback::poll() noexcept {
+  while(this->_pending_count > 0) {
+    const auto oldest = (this->_next_slot + this->_slots.size() - this->_pending_count) % this->_slots.size();
+    if(!this->_try_deliver(this->_slots[oldest], 0)) {
+      break; // later ones can't be done before this one.
+    }
+    --this->_pending_count;
+  }
+}
+
+void FrameReadback::flush() noexcept {
+  while(this->_pending_count > 0) {
+    const auto oldest = (this->_next_slot + this->_slots.size() - this->_pending_count) % this->_slots.size();
+    this->_try_deliver(this->_slots[oldest], std::numeric_limits<GLuint64>::max());
+    --this->_pending_count;
+  }
+  if(this->_workers) {
+    this->_workers->wait_idle();
+  }
+}
+
+[[nodiscard]] std::size_t FrameReadback::get_ring_size() const noexcept {
+  return this->_slots.size();
+}
+
+[[nodiscard]] std::size_t FrameReadback::get_pending_count() const noexcept {
+  return this->_pending_count;
+}
+
+[[nodiscard]] const std::uint64_t& FrameReadback::get_captured_count() const noexcept {
+  return this->_captured_count;
+}
+
+[[nodiscard]] const std::uint64_t& FrameReadback::get_dropped_count() const noexcept {
+  return this->_dropped_count;
+}
+
+bool FrameReadback::_try_deliver(Slot& slot, GLuint64 timeout_ns) noexcept {
+  // flush bit makes sure fence is actually submitted, otherwise
+  // polling with zero timeout might never see it signaled.
+  const auto status = glClientWaitSync(slot.fence, GL_SYNC_FLUSH_COMMANDS_BIT, timeout_ns);
+  if(status == GL_TIMEOUT_EXPIRED) {
+    return false;
+  }
+  glDeleteSync(slot.fence);
+  slot.fence = nullptr;
+  if(status == GL_WAIT_FAILED) {
+    std::cout << "fre2d error: FrameReadback: glClientWaitSync failed, frame "
+              << slot.frame_index << " is dropped.\n";
+    return true;
+  }
+
+  ReadbackFrame frame {
+    slot.frame_index,
+    slot.width,
+    slot.height,
+    std::vector<std::uint8_t>(
+      static_cast<std::size_t>(slot.width) * slot.height * detail::frame_readback::bytes_per_pixel
+    )
+  };
+  // only memcpy happens on render thread; data is already in host-visible memory.
+  if(const auto* mapped = glMapNamedBufferRange(slot.pbo_id, 0, static_cast<GLsizeiptr>(frame.pixels.size()), GL_MAP_READ_BIT)) {
+    std::memcpy(frame.pixels.data(), mapped, frame.pixels.size());
+    glUnmapNamedBuffer(slot.pbo_id);
+  }
+
+  if(this->_workers) {
+    this->_workers->submit([callback = this->_callback, frame = std::move(frame)]() mutable {
+      callback(frame);
+    });
+  } else {
+    this->_callback(frame);
+  }
+  return true;
+}
+} // namespace fre2d
@@ -5,31 +5,76 @@
 //
 #include <framebuffer.hpp>
 #include <iostream>
+#include <algorithm>
+#include <cstring>
 #include <renderer.hpp>
 
 namespace fre2d {
 Framebuffer::Framebuffer()
-  : _first_time{true},
+  : _fbo_id{0},
+    _msaa_fbo_id{0},
     _width{detail::renderer::default_width},
-    _height{detail::renderer::default_height}, _clear_called{false} {}
+    _height{detail::renderer::default_height},
+    _capacity_width{detail::renderer::default_width},
+    _capacity_height{detail::renderer::default_height},
+    _resize_policy{detail::framebuffer::default_resize_policy},
+    _first_time{true},
+    _clear_called{false},
+    _pass_through{false},
+    _blit_present{detail::framebuffer::default_blit_present},
+    _invalidate_transient{detail::framebuffer::default_invalidate_transient} {}
 
 Framebuffer::Framebuffer(GLsizei width,
                          GLsizei height,
                          bool use_default,
                          const char* default_vertex_shader,
                          const char* default_fragment_shader) noexcept
-  : _first_time{true}, _clear_called{false} {
+  : _fbo_id{0},
+    _msaa_fbo_id{0},
+    _width{0},
+    _height{0},
+    _capacity_width{0},
+    _capacity_height{0},
+    _resize_policy{detail::framebuffer::default_resize_policy},
+    _first_time{true},
+    _clear_called{false},
+    _pass_through{false},
+    _blit_present{detail::framebuffer::default_blit_present},
+    _invalidate_transient{detail::framebuffer::default_invalidate_transient} {
   this->initialize(width, height, use_default, default_vertex_shader, default_fragment_shader);
 }
 
+Framebuffer::Framebuffer(GLsizei width,
+                         GLsizei height,
+                         const RenderTargetDesc& desc,
+                         const char* default_vertex_shader,
+                         const char* default_fragment_shader) noexcept
+  : _fbo_id{0},
+    _msaa_fbo_id{0},
+    _width{0},
+    _height{0},
+    _capacity_width{0},
+    _capacity_height{0},
+    _resize_policy{detail::framebuffer::default_resize_policy},
+    _first_time{true},
+    _clear_called{false},
+    _pass_through{false},
+    _blit_present{detail::framebuffer::default_blit_present},
+    _invalidate_transient{detail::framebuffer::default_invalidate_transient} {
+  this->initialize(width, height, desc, default_vertex_shader, default_fragment_shader);
+}
+
 Framebuffer::~Framebuffer() noexcept {
   if(this->_fbo_id != 0) {
     glDeleteFramebuffers(1, &this->_fbo_id);
   }
+  if(this->_msaa_fbo_id != 0) {
+    glDeleteFramebuffers(1, &this->_msaa_fbo_id);
+  }
 }
 
 void Framebuffer::bind() noexcept {
-  glBindFramebuffer(GL_FRAMEBUFFER, this->get_fbo_id());
+  glBindFramebuffer(GL_FRAMEBUFFER, this->get_render_fbo_id());
   // since fre2d::Framebuffer can work with custom or default framebuffers;
   // it's okay to use resize function; check for width and height deltas;
   // then do appropriated calls. like for default framebuffers just directly
@@ -45,13 +90,13 @@ void Framebuffer::initialize(GLsizei width,
                              const char* default_vertex_shader,
                              const char* default_fragment_shader,
                              const AdditionalTextures& additional_textures) noexcept {
-  if(!this->_first_time) {
-    std::cout << "error: cannot initialize same buffer more than once.\n";
-    return;
-  }
-  this->_width = width;
-  this->_height = height;
   if(use_default) {
+    if(!this->_first_time) {
+      std::cout << "error: cannot initialize same buffer more than once.\n";
+      return;
+    }
+    this->_width = this->_capacity_width = width;
+    this->_height = this->_capacity_height = height;
     this->_fbo_id = 0; // default framebuffer
     // sync width and height for viewport.
     this->bind();
@@ -59,26 +104,81 @@ void Framebuffer::initialize(GLsizei width,
     this->_first_time = false;
     return;
   }
-  // in resize(); we call initialize() so recompiling and -linking
-  // shaders are not necessary.
-  // --
+  this->initialize(
+    width,
+    height,
+    RenderTargetDesc::default_value(),
+    default_vertex_shader,
+    default_fragment_shader,
+    additional_textures
+  );
+}
+
+void Framebuffer::initialize(GLsizei width,
+                             GLsizei height,
+                             const RenderTargetDesc& desc,
+                             const char* default_vertex_shader,
+                             const char* default_fragment_shader,
+                             const AdditionalTextures& additional_textures) noexcept {
+  if(!this->_first_time) {
+    std::cout << "error: cannot initialize same buffer more than once.\n";
+    return;
+  }
+  if(desc.color_formats.empty() || desc.color_formats.size() > detail::render_target::max_color_attachments) {
+    std::cout << "error: framebuffer needs 1 to " << detail::render_target::max_color_attachments
+              << " color attachments, " << desc.color_formats.size() << " given.\n";
+    return;
+  }
+  this->_width = this->_capacity_width = width;
+  this->_height = this->_capacity_height = height;
+  this->_desc = desc;
+  this->_desc.samples = std::max(this->_desc.samples, 1);
+
   // it creates custom framebuffer.
   if(this->_shader.get_program_id() == 0) {
+    this->_pass_through =
+      std::strcmp(default_vertex_shader, detail::framebuffer::default_vertex) == 0 &&
+      std::strcmp(default_fragment_shader, detail::framebuffer::default_fragment) == 0;
     this->_shader.initialize(default_vertex_shader, default_fragment_shader);
     this->_shader.use();
     this->_shader.set_int("ScreenTexture", 0);
-    this->set_additional_textures(additional_textures);
   }
+  this->set_additional_textures(additional_textures);
 
-  // create framebuffer
+  // create framebuffer; if multisampled, this one only holds resolved color textures.
   glGenFramebuffers(1, &this->_fbo_id);
   glBindFramebuffer(GL_FRAMEBUFFER, this->_fbo_id);
+  if(this->_desc.samples > 1) {
+    glGenFramebuffers(1, &this->_msaa_fbo_id);
+    glBindFramebuffer(GL_FRAMEBUFFER, this->_msaa_fbo_id);
+  }
 
-  this->_color_buffer.load_nothing(width, height, false, false);
-  this->_color_buffer.attach(*this);
+  std::array<GLenum, detail::render_target::max_color_attachments> draw_buffers {};
+  this->_color_buffers.resize(this->_desc.color_formats.size());
+  for(std::size_t i = 0; i < this->_color_buffers.size(); ++i) {
+    const auto attachment = static_cast<GLenum>(GL_COLOR_ATTACHMENT0 + i);
+    const auto format = this->_desc.color_formats[i];
+    this->_color_buffers[i]._framebuffer_load(width, height, static_cast<GLint>(format));
+    this->_color_buffers[i].attach(*this, attachment);
+    if(this->_desc.samples > 1) {
+      this->_msaa_color_rbs[i].initialize(width, height, format, attachment, this->_desc.samples);
+      glNamedFramebufferRenderbuffer(this->_msaa_fbo_id, attachment, GL_RENDERBUFFER, this->_msaa_color_rbs[i].get_rbo_id());
+    }
+    draw_buffers[i] = attachment;
+  }
+  const auto draw_buffer_count = static_cast<GLsizei>(this->_color_buffers.size());
+  glNamedFramebufferDrawBuffers(this->_fbo_id, draw_buffer_count, draw_buffers.data());
 
-  this->_depth_and_stencil_rb.initialize(width, height);
-  this->_depth_and_stencil_rb.attach(*this);
+  if(this->_desc.samples > 1) {
+    glNamedFramebufferDrawBuffers(this->_msaa_fbo_id, draw_buffer_count, draw_buffers.data());
+  }
+
+  // 2D scenes rarely need them, so it's optional.
+  if(this->_desc.depth_stencil != DepthStencilNone) {
+    const auto attachment = detail::render_target::get_attachment_point(this->_desc.depth_stencil);
+    this->_depth_and_stencil_rb.initialize(width, height, this->_desc.depth_stencil, attachment, this->_desc.samples);
+    glNamedFramebufferRenderbuffer(this->get_render_fbo_id(), attachment, GL_RENDERBUFFER, this->_depth_and_stencil_rb.get_rbo_id());
+  }
 
   // TODO: remove shader defaults.
   this->_fb_vao.initialize();
@@ -98,6 +198,7 @@ void Framebuffer::initialize(GLsizei width,
   glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)(6 * sizeof(float)));
   glEnableVertexAttribArray(2);
 
+  glBindFramebuffer(GL_FRAMEBUFFER, 0);
   this->_first_time = false;
 }
 
@@ -105,20 +206,65 @@ void Framebuffer::unbind() noexcept {
   glBindFramebuffer(GL_FRAMEBUFFER, 0);
   if(this->get_fbo_id() != 0) {
     glDisable(GL_DEPTH_TEST | GL_STENCIL_TEST);
+    this->resolve();
+    if(this->_invalidate_transient) {
+      this->_invalidate_transient_attachments();
+    }
+  }
+}
+
+void Framebuffer::resolve() const noexcept {
+  if(this->_msaa_fbo_id == 0) {
+    return;
+  }
+  // blit reads from one read buffer, so we resolve attachments one by one.
+  for(std::size_t i = 0; i < this->_color_buffers.size(); ++i) {
+    const auto attachment = static_cast<GLenum>(GL_COLOR_ATTACHMENT0 + i);
+    glNamedFramebufferReadBuffer(this->_msaa_fbo_id, attachment);
+    glNamedFramebufferDrawBuffer(this->_fbo_id, attachment);
+    glBlitNamedFramebuffer(
+      this->_msaa_fbo_id,
+      this->_fbo_id,
+      0, 0, this->get_width(), this->get_height(),
+      0, 0, this->get_width(), this->get_height(),
+      GL_COLOR_BUFFER_BIT,
+      GL_NEAREST
+    );
+  }
+  std::array<GLenum, detail::render_target::max_color_attachments> draw_buffers {};
+  for(std::size_t i = 0; i < this->_color_buffers.size(); ++i) {
+    draw_buffers[i] = static_cast<GLenum>(GL_COLOR_ATTACHMENT0 + i);
   }
+  glNamedFramebufferDrawBuffers(this->_fbo_id, static_cast<GLsizei>(this->_color_buffers.size()), draw_buffers.data());
 }
 
 // use at the end of render loop right before of swapping buffers.
 void Framebuffer::render_texture() noexcept {
+  if(this->_blit_present && this->is_pass_through()) {
+    // no program, vao or texture binds; driver copies pixels directly.
+    ProfileScope scope("Framebuffer::render_texture");
+    this->_blit_color_buffer();
+    return;
+  }
+  this->render_texture(this->_shader);
+}
+
+void Framebuffer::render_texture(const Shader& shader) noexcept {
+  ProfileScope scope("Framebuffer::render_texture");
   if(this->get_fbo_id() != 0) {
-    this->_shader.use();
+    if(!shader.is_ready()) {
+      return;
+    }
+    shader.use();
     this->_fb_vao.bind();
     this->_fb_vbo.bind();
-    this->_color_buffer.bind(); // slot to 0
+    // program might be shared between framebuffers, so it's set per draw.
+    this->_update_tex_coords_scale(shader);
+    this->_color_buffers[0].bind(); // slot to 0
     // texture slots for additional textures must start from 1 to 16 or 32
     // depending on the hardware and API support.
     for(auto& info: this->_additional_textures) {
-      info.texture.bind(info.sampler_id);
+      Texture::bind(info.texture, info.sampler_id);
     }
     glDrawArrays(GL_TRIANGLES, 0, 6);
     this->_fb_vao.unbind();
@@ -136,31 +282,174 @@ void Framebuffer::resize(GLsizei width, GLsizei height) noexcept {
     this->_height = height;
 
     if(this->get_fbo_id() != 0) {
-      // there might be better way to do this;
-      // but for now we recreate everything.
-      glDeleteFramebuffers(1, &this->_fbo_id);
-      this->_color_buffer = {};
-      this->_depth_and_stencil_rb = {};
-      this->_first_time = true;
-      this->initialize(width, height);
-      if(!this->is_complete()) {
-        // TODO: use custom logging
-        std::cout << "error: framebuffer is not complete\n";
+      // we only reallocate storage of attachments; fbo, shader, vao and vbo
+      // stay as is. with ResizeGrow, most of resizes (e.g. window drags) don't
+      // even touch attachments since we render into sub-viewport.
+      GLsizei capacity_width { this->_capacity_width };
+      GLsizei capacity_height { this->_capacity_height };
+      if(this->_resize_policy == ResizeExact) {
+        capacity_width = width;
+        capacity_height = height;
+      } else {
+        const auto grow = [](GLsizei size) {
+          const auto grown = static_cast<GLsizei>(static_cast<float>(size) * detail::framebuffer::growth_factor);
+          return (grown + detail::framebuffer::growth_alignment - 1)
+            / detail::framebuffer::growth_alignment * detail::framebuffer::growth_alignment;
+        };
+        if(width > capacity_width || height > capacity_height) {
+          if(width > capacity_width) {
+            capacity_width = grow(width);
+          }
+          if(height > capacity_height) {
+            capacity_height = grow(height);
+          }
+        } else if(width * 2 < capacity_width && height * 2 < capacity_height) {
+          // too much memory wasted, give it back.
+          capacity_width = grow(width);
+          capacity_height = grow(height);
+        }
+      }
+      if(capacity_width != this->_capacity_width || capacity_height != this->_capacity_height) {
+        this->_reallocate_attachments(capacity_width, capacity_height);
       }
     }
     // update viewport
     glBindFramebuffer(GL_FRAMEBUFFER, this->get_fbo_id());
     glViewport(0, 0, this->get_width(), this->get_height());
-    this->unbind();
+    // not unbind(); nothing is drawn here, so there is nothing to resolve
+    // or invalidate.
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    if(this->get_fbo_id() != 0) {
+      glDisable(GL_DEPTH_TEST | GL_STENCIL_TEST);
+    }
   }
 }
 
+void Framebuffer::set_resize_policy(ResizePolicy policy) noexcept {
+  this->_resize_policy = policy;
+}
+
+[[nodiscard]] const ResizePolicy& Framebuffer::get_resize_policy() const noexcept {
+  return this->_resize_policy;
+}
+
+void Framebuffer::set_blit_present_enabled(bool enabled) noexcept {
+  this->_blit_present = enabled;
+}
+
+[[nodiscard]] const bool& Framebuffer::get_blit_present_enabled() const noexcept {
+  return this->_blit_present;
+}
+
+[[nodiscard]] bool Framebuffer::is_pass_through() const noexcept {
+  return this->get_fbo_id() != 0 && this->_pass_through && this->_additional_textures.empty();
+}
+
+void Framebuffer::set_invalidate_transient_enabled(bool enabled) noexcept {
+  this->_invalidate_transient = enabled;
+}
+
+[[nodiscard]] const bool& Framebuffer::get_invalidate_transient_enabled() const noexcept {
+  return this->_invalidate_transient;
+}
+
+void Framebuffer::_reallocate_attachments(GLsizei capacity_width, GLsizei capacity_height) noexcept {
+  this->_capacity_width = capacity_width;
+  this->_capacity_height = capacity_height;
+  for(std::size_t i = 0; i < this->_color_buffers.size(); ++i) {
+    this->_color_buffers[i]._framebuffer_load(capacity_width, capacity_height, static_cast<GLint>(this->_desc.color_formats[i]));
+    if(this->_msaa_fbo_id != 0) {
+      this->_msaa_color_rbs[i].resize(capacity_width, capacity_height);
+    }
+  }
+  if(this->_desc.depth_stencil != DepthStencilNone) {
+    this->_depth_and_stencil_rb.resize(capacity_width, capacity_height);
+  }
+  if(!this->is_complete()) {
+    // TODO: use custom logging
+    std::cout << "error: framebuffer is not complete\n";
+  }
+}
+
+void Framebuffer::_blit_color_buffer() const noexcept {
+  // same target as fullscreen quad would be drawn into: bound draw framebuffer's viewport.
+  GLint draw_fbo_id { 0 };
+  std::array<GLint, 4> viewport {};
+  glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &draw_fbo_id);
+  glGetIntegerv(GL_VIEWPORT, viewport.data());
+  const bool same_size { viewport[2] == this->get_width() && viewport[3] == this->get_height() };
+  // reads GL_COLOR_ATTACHMENT0 of resolved framebuffer; only rendered
+  // sub-rectangle, so over-allocated capacity does not matter here.
+  glBlitNamedFramebuffer(
+    this->get_fbo_id(),
+    static_cast<GLuint>(draw_fbo_id),
+    0, 0, this->get_width(), this->get_height(),
+    viewport[0], viewport[1], viewport[0] + viewport[2], viewport[1] + viewport[3],
+    GL_COLOR_BUFFER_BIT,
+    same_size ? GL_NEAREST : GL_LINEAR
+  );
+}
+
+void Framebuffer::_invalidate_transient_attachments() const noexcept {
+  std::array<GLenum, detail::render_target::max_color_attachments + 1> attachments {};
+  GLsizei count { 0 };
+  // multisample color is already copied into textures by resolve().
+  if(this->_msaa_fbo_id != 0) {
+    for(std::size_t i = 0; i < this->_color_buffers.size(); ++i) {
+      attachments[count++] = static_cast<GLenum>(GL_COLOR_ATTACHMENT0 + i);
+    }
+  }
+  if(this->_desc.depth_stencil != DepthStencilNone) {
+    attachments[count++] = detail::render_target::get_attachment_point(this->_desc.depth_stencil);
+  }
+  if(count > 0) {
+    glInvalidateNamedFramebufferData(this->get_render_fbo_id(), count, attachments.data());
+  }
+}
+
+void Framebuffer::_update_tex_coords_scale(const Shader& shader) const noexcept {
+  shader.set_float_vec2("TexCoordsScale", glm::vec2 {
+    static_cast<GLfloat>(this->get_width()) / static_cast<GLfloat>(this->_capacity_width),
+    static_cast<GLfloat>(this->get_height()) / static_cast<GLfloat>(this->_capacity_height)
+  });
+}
+
 [[nodiscard]] const GLuint &Framebuffer::get_fbo_id() const noexcept {
   return this->_fbo_id;
 }
 
+[[nodiscard]] const GLuint& Framebuffer::get_render_fbo_id() const noexcept {
+  return this->_msaa_fbo_id != 0 ? this->_msaa_fbo_id : this->_fbo_id;
+}
+
 [[nodiscard]] bool Framebuffer::is_complete() const noexcept {
-  return glCheckNamedFramebufferStatus(this->get_fbo_id(), GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+  const auto is_fbo_complete = [](GLuint fbo_id) {
+    return glCheckNamedFramebufferStatus(fbo_id, GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+  };
+  return is_fbo_complete(this->get_fbo_id()) &&
+         (this->_msaa_fbo_id == 0 || is_fbo_complete(this->_msaa_fbo_id));
+}
+
+[[nodiscard]] const RenderTargetDesc& Framebuffer::get_render_target_desc() const noexcept {
+  return this->_desc;
+}
+
+[[nodiscard]] std::size_t Framebuffer::get_memory_usage() const noexcept {
+  if(this->get_fbo_id() == 0) {
+    return 0;
+  }
+  std::size_t color_bytes_per_pixel { 0 };
+  for(const auto& format: this->_desc.color_formats) {
+    color_bytes_per_pixel += detail::render_target::get_bytes_per_pixel(format);
+  }
+  const auto samples = static_cast<std::size_t>(this->_desc.samples);
+  std::size_t bytes_per_pixel { color_bytes_per_pixel };
+  if(samples > 1) {
+    bytes_per_pixel += color_bytes_per_pixel * samples;
+  }
+  bytes_per_pixel += detail::render_target::get_bytes_per_pixel(this->_desc.depth_stencil) * samples;
+  return static_cast<std::size_t>(this->_capacity_width) *
+         static_cast<std::size_t>(this->_capacity_height) * bytes_per_pixel;
 }
 
 [[nodiscard]] const GLsizei& Framebuffer::get_width() const noexcept {
@@ -171,9 +460,52 @@ void Framebuffer::resize(GLsizei width, GLsizei height) noexcept {
   return this->_height;
 }
 
-  // notice: using this function with default framebuffer will return 0.
-[[nodiscard]] const Texture& Framebuffer::get_color_buffer() const noexcept {
-  return this->_color_buffer;
+[[nodiscard]] const GLsizei& Framebuffer::get_capacity_width() const noexcept {
+  return this->_capacity_width;
+}
+
+[[nodiscard]] const GLsizei& Framebuffer::get_capacity_height() const noexcept {
+  return this->_capacity_height;
+}
+
+// notice: using this function with default framebuffer will return 0.
+[[nodiscard]] const Texture& Framebuffer::get_color_buffer(std::size_t index) const noexcept {
+  if(index >= this->_color_buffers.size()) {
+    // default framebuffer or out of range; same as uninitialized color buffer.
+    static const Texture empty_color_buffer;
+    return empty_color_buffer;
+  }
+  return this->_color_buffers[index];
+}
+
+[[nodiscard]] std::size_t Framebuffer::get_color_buffer_count() const noexcept {
+  return this->_color_buffers.size();
+}
+
+[[nodiscard]] const std::vector<Texture>& Framebuffer::get_color_buffers() const noexcept {
+  return this->_color_buffers;
+}
+
+[[nodiscard]] AdditionalTextures Framebuffer::get_color_buffers_as_additional_textures(
+  GLint first_sampler_id,
+  const std::vector<const char*>& sampler_names
+) const noexcept {
+  if(sampler_names.size() != this->_color_buffers.size()) {
+    std::cout << "error: framebuffer has " << this->_color_buffers.size()
+              << " color attachments, " << sampler_names.size() << " sampler names given.\n";
+  }
+  // handles refer to attachments, so in-place resizes of this framebuffer
+  // are visible through them too.
+  AdditionalTextures additional_textures;
+  const auto count = std::min(sampler_names.size(), this->_color_buffers.size());
+  for(std::size_t i = 0; i < count; ++i) {
+    additional_textures.push_back(AdditionalTexturesInfo{
+      first_sampler_id + static_cast<GLint>(i),
+      sampler_names[i],
+      this->_color_buffers[i].get_handle()
+    });
+  }
+  return additional_textures;
 }
 
 // notice: using this function with default framebuffer will return 0.
@@ -193,6 +525,12 @@ void Framebuffer::resize(GLsizei width, GLsizei height) noexcept {
   return this->_shader;
 }
 
+void Framebuffer::set_framebuffer_shader(const Shader& shader, bool pass_through) noexcept {
+  this->_shader = shader;
+  this->_pass_through = pass_through;
+  this->_shader.set_int("ScreenTexture", 0);
+}
+
 void Framebuffer::clear_color(GLfloat red, GLfloat green, GLfloat blue,
                               GLfloat alpha) noexcept {
   if(this->get_fbo_id() != 0) {
@@ -0,0 +1,291 @@
+// MIT License
+//
+// Copyright (c) 2025 Ferhat Geçdoğan All Rights Reserved.
+// Distributed under the terms of the MIT License.
+//
+#include <gpu_memory_tracker.hpp>
+#include <async_texture_loader.hpp>
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace fre2d {
+[[nodiscard]] std::size_t get_internal_format_bytes(GLenum internal_format) noexcept {
+  switch(internal_format) {
+  case GL_RED:
+  case GL_GREEN:
+  case GL_BLUE:
+  case GL_R8: {
+    return 1;
+  }
+  case GL_RG8:
+  case GL_R16F:
+  case GL_RGB565:
+  case GL_RGBA4:
+  case GL_RGB5_A1:
+  case GL_DEPTH_COMPONENT16: {
+    return 2;
+  }
+  case GL_RGB:
+  case GL_RGB8: {
+    return 3;
+  }
+  case GL_RGBA16F:
+  case GL_RG32F: {
+    return 8;
+  }
+  case GL_RGBA32F: {
+    return 16;
+  }
+  default: {
+    // RGBA8, SRGB8_ALPHA8, RG16F, R32F, RGB10_A2, R11F_G11F_B10F, depth(-stencil).
+    return 4;
+  }
+  }
+}
+
+[[nodiscard]] std::size_t get_mip_chain_bytes(GLsizei width,
+                                              GLsizei height,
+                                              std::size_t bytes_per_pixel,
+                                              GLsizei levels) noexcept {
+  std::size_t bytes { 0 };
+  for(GLsizei level = 0; level < levels; ++level) {
+    bytes += static_cast<std::size_t>(std::max(width >> level, 1)) *
+             static_cast<std::size_t>(std::max(height >> level, 1)) * bytes_per_pixel;
+  }
+  return bytes;
+}
+
+GpuMemoryTracker::GpuMemoryTracker() noexcept
+  : _bytes{},
+    _total_bytes{0},
+    _peak_total_bytes{0},
+    _evicted_count{0},
+    _eviction_count{0},
+    _reload_count{0},
+    _budget{detail::gpu_memory_tracker::default_budget},
+    _evict_after_frames{detail::gpu_memory_tracker::default_evict_after_frames},
+    _frame{0},
+    _loader{nullptr} {}
+
+[[nodiscard]] GpuMemoryTracker& GpuMemoryTracker::get() noexcept {
+  thread_local GpuMemoryTracker tracker;
+  return tracker;
+}
+
+void GpuMemoryTracker::track(GpuMemoryClass memory_class, std::uint32_t key, std::size_t bytes) noexcept {
+  if(key == 0) {
+    return;
+  }
+  Record new_record {};
+  new_record.last_used_frame = this->_frame;
+  auto [record, inserted] = this->_records[memory_class].try_emplace(key, std::move(new_record));
+  if(record->second.evicted) {
+    // uploaded by other means than reload (e.g. loaded again).
+    record->second.evicted = false;
+    --this->_evicted_count;
+  }
+  record->second.last_used_frame = this->_frame;
+  this->_set_bytes(memory_class, record->second, bytes);
+}
+
+void GpuMemoryTracker::untrack(GpuMemoryClass memory_class, std::uint32_t key) noexcept {
+  const auto record = this->_records[memory_class].find(key);
+  if(record == this->_records[memory_class].end()) {
+    return;
+  }
+  this->_set_bytes(memory_class, record->second, 0);
+  if(record->second.evicted) {
+    --this->_evicted_count;
+  }
+  this->_records[memory_class].erase(record);
+}
+
+void GpuMemoryTracker::touch(TextureHandle handle) noexcept {
+  const auto found = this->_records[GpuMemoryClassTexture].find(handle.value);
+  if(found == this->_records[GpuMemoryClassTexture].end()) {
+    return;
+  }
+  auto& record = found->second;
+  record.last_used_frame = this->_frame;
+  if(!record.evicted || !this->_loader) {
+    return;
+  }
+  // stays 0 bytes until upload; so it can't be evicted while it's queued.
+  record.evicted = false;
+  --this->_evicted_count;
+  ++this->_reload_count;
+  this->_loader->_enqueue(
+    handle,
+    record.source.file_path.c_str(),
+    record.source.use_nearest,
+    record.source.use_mipmap,
+    record.source.texture_wrap,
+    record.source.premultiply_alpha,
+    record.source.sampler
+  );
+}
+
+void GpuMemoryTracker::set_stream_source(TextureHandle handle,
+                                         const char* file_path,
+                                         bool use_nearest,
+                                         bool use_mipmap,
+                                         const Texture::WrapOptions& texture_wrap,
+                                         bool premultiply_alpha) noexcept {
+  if(handle.is_null() || !file_path) {
+    return;
+  }
+  Record new_record {};
+  new_record.last_used_frame = this->_frame;
+  auto [record, inserted] = this->_records[GpuMemoryClassTexture].try_emplace(handle.value, std::move(new_record));
+  // sampler is set by upload, which comes before this.
+  record->second.source = StreamSource {
+    file_path, texture_wrap, use_nearest, use_mipmap, premultiply_alpha, record->second.source.sampler
+  };
+  record->second.has_source = true;
+}
+
+void GpuMemoryTracker::forget_stream_source(TextureHandle handle) noexcept {
+  const auto found = this->_records[GpuMemoryClassTexture].find(handle.value);
+  if(found != this->_records[GpuMemoryClassTexture].end()) {
+    found->second.has_source = false;
+    found->second.source.file_path.clear();
+  }
+}
+
+void GpuMemoryTracker::set_stream_sampler(TextureHandle handle, const SamplerDesc& sampler) noexcept {
+  const auto found = this->_records[GpuMemoryClassTexture].find(handle.value);
+  if(found != this->_records[GpuMemoryClassTexture].end()) {
+    found->second.source.sampler = sampler;
+  }
+}
+
+void GpuMemoryTracker::set_streaming_loader(AsyncTextureLoader* loader) noexcept {
+  const bool was_streaming { this->is_streaming() };
+  this->_loader = loader;
+  this->_on_streaming_changed(was_streaming);
+}
+
+void GpuMemoryTracker::set_budget(std::size_t bytes) noexcept {
+  const bool was_streaming { this->is_streaming() };
+  this->_budget = bytes;
+  this->_on_streaming_changed(was_streaming);
+}
+
+void GpuMemoryTracker::set_evict_after_frames(std::uint64_t frames) noexcept {
+  this->_evict_after_frames = frames;
+}
+
+[[nodiscard]] std::size_t GpuMemoryTracker::get_bytes(GpuMemoryClass memory_class) const noexcept {
+  return this->_bytes[memory_class];
+}
+
+[[nodiscard]] std::size_t GpuMemoryTracker::get_bytes(GpuMemoryClass memory_class, std::uint32_t key) const noexcept {
+  const auto found = this->_records[memory_class].find(key);
+  return found != this->_records[memory_class].end() ? found->second.bytes : 0;
+}
+
+[[nodiscard]] std::size_t GpuMemoryTracker::get_total_bytes() const noexcept {
+  return this->_total_bytes;
+}
+
+[[nodiscard]] std::size_t GpuMemoryTracker::get_peak_total_bytes() const noexcept {
+  return this->_peak_total_bytes;
+}
+
+[[nodiscard]] std::size_t GpuMemoryTracker::get_count(GpuMemoryClass memory_class) const noexcept {
+  return this->_records[memory_class].size();
+}
+
+[[nodiscard]] std::size_t GpuMemoryTracker::get_evicted_count() const noexcept {
+  return this->_evicted_count;
+}
+
+[[nodiscard]] std::size_t GpuMemoryTracker::get_eviction_count() const noexcept {
+  return this->_eviction_count;
+}
+
+[[nodiscard]] std::size_t GpuMemoryTracker::get_reload_count() const noexcept {
+  return this->_reload_count;
+}
+
+[[nodiscard]] const std::size_t& GpuMemoryTracker::get_budget() const noexcept {
+  return this->_budget;
+}
+
+[[nodiscard]] const std::uint64_t& GpuMemoryTracker::get_evict_after_frames() const noexcept {
+  return this->_evict_after_frames;
+}
+
+[[nodiscard]] const std::uint64_t& GpuMemoryTracker::get_frame() const noexcept {
+  return this->_frame;
+}
+
+void GpuMemoryTracker::_end_frame() noexcept {
+  const auto& registry = ResourceRegistry::get();
+  for(std::size_t memory_class = 0; memory_class < GpuMemoryClassRenderbuffer; ++memory_class) {
+    auto& records = this->_records[memory_class];
+    for(auto record = records.begin(); record != records.end();) {
+      const bool valid {
+        memory_class == GpuMemoryClassTexture ? registry.is_valid(TextureHandle { record->first })
+                                              : registry.is_valid(BufferHandle { record->first })
+      };
+      if(valid) {
+        ++record;
+        continue;
+      }
+      this->_set_bytes(static_cast<GpuMemoryClass>(memory_class), record->second, 0);
+      if(record->second.evicted) {
+        --this->_evicted_count;
+      }
+      record = records.erase(record);
+    }
+  }
+  if(this->_budget != 0 && this->_loader && this->_total_bytes > this->_budget) {
+    this->_evict();
+  }
+  ++this->_frame;
+}
+
+void GpuMemoryTracker::_evict() noexcept {
+  // (last used frame, handle value) of candidates; oldest first.
+  std::vector<std::pair<std::uint64_t, std::uint32_t>> candidates;
+  for(const auto& [key, record]: this->_records[GpuMemoryClassTexture]) {
+    if(record.has_source && !record.evicted && record.bytes != 0 &&
+       this->_frame - record.last_used_frame >= this->_evict_after_frames) {
+      candidates.emplace_back(record.last_used_frame, key);
+    }
+  }
+  std::sort(candidates.begin(), candidates.end());
+  auto& registry = ResourceRegistry::get();
+  for(const auto& [last_used_frame, key]: candidates) {
+    if(this->_total_bytes <= this->_budget) {
+      break;
+    }
+    auto& record = this->_records[GpuMemoryClassTexture].at(key);
+    // name is deleted in this end_frame(); every copy sees id 0.
+    registry.set_name(TextureHandle { key }, 0);
+    this->_set_bytes(GpuMemoryClassTexture, record, 0);
+    record.evicted = true;
+    ++this->_evicted_count;
+    ++this->_eviction_count;
+  }
+}
+
+void GpuMemoryTracker::_on_streaming_changed(bool was_streaming) noexcept {
+  // binds were not recorded till now; without this, every texture would
+  // look unused and be evicted at once.
+  if(!was_streaming && this->is_streaming()) {
+    for(auto& [key, record]: this->_records[GpuMemoryClassTexture]) {
+      record.last_used_frame = this->_frame;
+    }
+  }
+}
+
+void GpuMemoryTracker::_set_bytes(GpuMemoryClass memory_class, Record& record, std::size_t bytes) noexcept {
+  this->_bytes[memory_class] = this->_bytes[memory_class] - record.bytes + bytes;
+  this->_total_bytes = this->_total_bytes - record.bytes + bytes;
+  this->_peak_total_bytes = std::max(this->_peak_total_bytes, this->_total_bytes);
+  record.bytes = bytes;
+}
+} // namespace fre2d
@@ -0,0 +1,309 @@
+// MIT License
+//
+// Copyright (c) 2025 Ferhat Geçdoğan All Rights Reserved.
+// Distributed under the terms of the MIT License.
+//
+#ifdef FRE2D_HEADLESS
+#include <headless_context.hpp>
+// we only use platform-independent displays; do not pull Xlib.
+#define EGL_NO_X11
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#ifdef FRE2D_HEADLESS_OSMESA
+// glad is included first, so osmesa.h does not pull GL/gl.h declarations.
+#include <GL/osmesa.h>
+#endif
+#include <array>
+#include <cstring>
+#include <iostream>
+#include <string_view>
+
+namespace fre2d {
+HeadlessContext::HeadlessContext() noexcept
+  : _egl_display{nullptr},
+    _egl_context{nullptr},
+    _egl_surface{nullptr},
+    _osmesa_context{nullptr},
+    _backend{HeadlessAuto},
+    _initialized{false} {}
+
+HeadlessContext::~HeadlessContext() noexcept {
+  this->release();
+}
+
+bool HeadlessContext::initialize(HeadlessBackend backend) noexcept {
+  if(this->_initialized) {
+    std::cout << "fre2d error: HeadlessContext is already initialized.\n";
+    return false;
+  }
+  // serializes display setup and glad loading between worker threads.
+  std::lock_guard lock(HeadlessContext::_get_mutex());
+  std::array<HeadlessBackend, 3> candidates { HeadlessEglSurfaceless, HeadlessEglDevice, HeadlessOsMesa };
+  const std::size_t candidate_count { backend == HeadlessAuto ? candidates.size() : 1 };
+  if(backend != HeadlessAuto) {
+    candidates[0] = backend;
+  }
+  for(std::size_t i = 0; i < candidate_count; ++i) {
+    const bool created {
+      candidates[i] == HeadlessOsMesa ?
+        this->_initialize_osmesa() :
+        this->_initialize_egl(candidates[i])
+    };
+    if(created && this->_load_gl()) {
+      this->_backend = candidates[i];
+      this->_initialized = true;
+      return true;
+    }
+    this->release();
+  }
+  std::cout << "fre2d error: HeadlessContext: could not create OpenGL "
+            << detail::headless_context::gl_major_version << "."
+            << detail::headless_context::gl_minor_version << " core context.\n";
+  return false;
+}
+
+[[nodiscard]] bool HeadlessContext::make_current() const noexcept {
+  if(this->_egl_context) {
+    return eglMakeCurrent(
+      this->_egl_display,
+      this->_egl_surface ? this->_egl_surface : EGL_NO_SURFACE,
+      this->_egl_surface ? this->_egl_surface : EGL_NO_SURFACE,
+      this->_egl_context
+    ) == EGL_TRUE;
+  }
+#ifdef FRE2D_HEADLESS_OSMESA
+  if(this->_osmesa_context) {
+    return OSMesaMakeCurrent(
+      static_cast<OSMesaContext>(this->_osmesa_context),
+      const_cast<GLubyte*>(this->_osmesa_buffer.data()),
+      GL_UNSIGNED_BYTE,
+      1,
+      1
+    ) == GL_TRUE;
+  }
+#endif
+  return false;
+}
+
+void HeadlessContext::release() noexcept {
+  std::lock_guard lock(HeadlessContext::_get_mutex());
+  if(this->_egl_display) {
+    eglMakeCurrent(this->_egl_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    if(this->_egl_surface) {
+      eglDestroySurface(this->_egl_display, this->_egl_surface);
+    }
+    if(this->_egl_context) {
+      eglDestroyContext(this->_egl_display, this->_egl_context);
+    }
+    HeadlessContext::_release_display(this->_egl_display);
+  }
+#ifdef FRE2D_HEADLESS_OSMESA
+  if(this->_osmesa_context) {
+    OSMesaDestroyContext(static_cast<OSMesaContext>(this->_osmesa_context));
+  }
+#endif
+  this->_egl_display = this->_egl_context = this->_egl_surface = nullptr;
+  this->_osmesa_context = nullptr;
+  this->_osmesa_buffer.clear();
+  this->_initialized = false;
+}
+
+[[nodiscard]] const bool& HeadlessContext::is_initialized() const noexcept {
+  return this->_initialized;
+}
+
+[[nodiscard]] const HeadlessBackend& HeadlessContext::get_backend() const noexcept {
+  return this->_backend;
+}
+
+[[nodiscard]] const char* HeadlessContext::get_renderer_name() const noexcept {
+  if(!this->_initialized) {
+    return "";
+  }
+  return reinterpret_cast<const char*>(glGetString(GL_RENDERER));
+}
+
+bool HeadlessContext::_initialize_egl(HeadlessBackend backend) noexcept {
+  // client extensions need EGL 1.5 or EGL_EXT_client_extensions; glvnd has both.
+  const char* client_extensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+  if(!client_extensions) {
+    std::cout << "fre2d warning: HeadlessContext: EGL client extensions are not supported.\n";
+    return false;
+  }
+
+  EGLDisplay display { EGL_NO_DISPLAY };
+  if(backend == HeadlessEglSurfaceless) {
+    if(!HeadlessContext::_has_extension(client_extensions, "EGL_MESA_platform_surfaceless")) {
+      std::cout << "fre2d warning: HeadlessContext: EGL_MESA_platform_surfaceless is not supported.\n";
+      return false;
+    }
+    display = eglGetPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, nullptr /* EGL_DEFAULT_DISPLAY */, nullptr);
+  } else {
+    const auto query_devices = reinterpret_cast<PFNEGLQUERYDEVICESEXTPROC>(eglGetProcAddress("eglQueryDevicesEXT"));
+    if(!HeadlessContext::_has_extension(client_extensions, "EGL_EXT_platform_device") || !query_devices) {
+      std::cout << "fre2d warning: HeadlessContext: EGL_EXT_platform_device is not supported.\n";
+      return false;
+    }
+    std::array<EGLDeviceEXT, 8> devices {};
+    EGLint device_count { 0 };
+    if(!query_devices(static_cast<EGLint>(devices.size()), devices.data(), &device_count) || device_count == 0) {
+      std::cout << "fre2d warning: HeadlessContext: no EGL device found.\n";
+      return false;
+    }
+    display = eglGetPlatformDisplay(EGL_PLATFORM_DEVICE_EXT, devices[0], nullptr);
+  }
+
+  EGLint egl_major { 0 }, egl_minor { 0 };
+  if(display == EGL_NO_DISPLAY || eglInitialize(display, &egl_major, &egl_minor) != EGL_TRUE) {
+    std::cout << "fre2d warning: HeadlessContext: could not initialize EGL display.\n";
+    return false;
+  }
+  this->_egl_display = display;
+  HeadlessContext::_retain_display(display);
+
+  if(eglBindAPI(EGL_OPENGL_API) != EGL_TRUE) {
+    std::cout << "fre2d warning: HeadlessContext: desktop OpenGL is not supported by EGL driver.\n";
+    return false;
+  }
+
+  // we never draw into default framebuffer, so config only matters for pbuffer fallback.
+  constexpr std::array<EGLint, 13> config_attributes {
+    EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+    EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+    EGL_RED_SIZE, 8,
+    EGL_GREEN_SIZE, 8,
+    EGL_BLUE_SIZE, 8,
+    EGL_ALPHA_SIZE, 8,
+    EGL_NONE
+  };
+  EGLConfig config { nullptr };
+  EGLint config_count { 0 };
+  if(eglChooseConfig(display, config_attributes.data(), &config, 1, &config_count) != EGL_TRUE || config_count == 0) {
+    std::cout << "fre2d warning: HeadlessContext: no suitable EGL config.\n";
+    return false;
+  }
+
+  constexpr std::array<EGLint, 7> context_attributes {
+    EGL_CONTEXT_MAJOR_VERSION, detail::headless_context::gl_major_version,
+    EGL_CONTEXT_MINOR_VERSION, detail::headless_context::gl_minor_version,
+    EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+    EGL_NONE
+  };
+  this->_egl_context = eglCreateContext(display, config, EGL_NO_CONTEXT, context_attributes.data());
+  if(this->_egl_context == EGL_NO_CONTEXT) {
+    this->_egl_context = nullptr;
+    std::cout << "fre2d warning: HeadlessContext: eglCreateContext failed (0x"
+              << std::hex << eglGetError() << std::dec << ").\n";
+    return false;
+  }
+
+  if(!HeadlessContext::_has_extension(eglQueryString(display, EGL_EXTENSIONS), "EGL_KHR_surfaceless_context")) {
+    constexpr std::array<EGLint, 5> pbuffer_attributes { EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE };
+    this->_egl_surface = eglCreatePbufferSurface(display, config, pbuffer_attributes.data());
+    if(this->_egl_surface == EGL_NO_SURFACE) {
+      this->_egl_surface = nullptr;
+      std::cout << "fre2d warning: HeadlessContext: could not create pbuffer surface.\n";
+      return false;
+    }
+  }
+  return this->make_current();
+}
+
+bool HeadlessContext::_initialize_osmesa() noexcept {
+#ifdef FRE2D_HEADLESS_OSMESA
+  constexpr std::array<int, 13> attributes {
+    OSMESA_FORMAT, OSMESA_RGBA,
+    OSMESA_DEPTH_BITS, 24,
+    OSMESA_STENCIL_BITS, 8,
+    OSMESA_PROFILE, OSMESA_CORE_PROFILE,
+    OSMESA_CONTEXT_MAJOR_VERSION, detail::headless_context::gl_major_version,
+    OSMESA_CONTEXT_MINOR_VERSION, detail::headless_context::gl_minor_version,
+    0
+  };
+  this->_osmesa_context = OSMesaCreateContextAttribs(attributes.data(), nullptr);
+  if(!this->_osmesa_context) {
+    std::cout << "fre2d warning: HeadlessContext: OSMesaCreateContextAttribs failed.\n";
+    return false;
+  }
+  this->_osmesa_buffer.resize(4); // 1x1 RGBA
+  return this->make_current();
+#else
+  std::cout << "fre2d warning: HeadlessContext: fre2d is built without OSMesa support.\n";
+  return false;
+#endif
+}
+
+bool HeadlessContext::_load_gl() noexcept {
+  // glad pointers are shared by every context of the process; on glvnd/Mesa
+  // they dispatch to whatever context is current, so loading once is enough.
+  static bool loaded { false };
+  if(loaded) {
+    return true;
+  }
+  GLADloadproc loader { reinterpret_cast<GLADloadproc>(eglGetProcAddress) };
+#ifdef FRE2D_HEADLESS_OSMESA
+  if(this->_osmesa_context) {
+    loader = reinterpret_cast<GLADloadproc>(OSMesaGetProcAddress);
+  }
+#endif
+  if(!gladLoadGLLoader(loader)) {
+    std::cout << "fre2d error: HeadlessContext: failed to initialize GLAD.\n";
+    return false;
+  }
+  if(GLVersion.major < detail::headless_context::gl_major_version ||
+     (GLVersion.major == detail::headless_context::gl_major_version &&
+      GLVersion.minor < detail::headless_context::gl_minor_version)) {
+    std::cout << "fre2d error: HeadlessContext: got OpenGL "
+              << GLVersion.major << "." << GLVersion.minor << " context.\n";
+    return false;
+  }
+  loaded = true;
+  return true;
+}
+
+[[nodiscard]] bool HeadlessContext::_has_extension(const char* extensions, const char* name) noexcept {
+  if(!extensions) {
+    return false;
+  }
+  const std::string_view list { extensions };
+  const std::string_view wanted { name };
+  for(std::size_t begin = 0; begin < list.size();) {
+    auto end = list.find(' ', begin);
+    if(end == std::string_view::npos) {
+      end = list.size();
+    }
+    if(list.substr(begin, end - begin) == wanted) {
+      return true;
+    }
+    begin = end + 1;
+  }
+  return false;
+}
+
+void HeadlessContext::_retain_display(void* display) noexcept {
+  ++HeadlessContext::_get_display_references()[display];
+}
+
+void HeadlessContext::_release_display(void* display) noexcept {
+  auto& references = HeadlessContext::_get_display_references();
+  const auto it = references.find(display);
+  if(it == references.end()) {
+    return;
+  }
+  if(--it->second == 0) {
+    references.erase(it);
+    eglTerminate(display);
+  }
+}
+
+[[nodiscard]] std::unordered_map<void*, std::size_t>& HeadlessContext::_get_display_references() noexcept {
+  static std::unordered_map<void*, std::size_t> references;
+  return references;
+}
+
+[[nodiscard]] std::recursive_mutex& HeadlessContext::_get_mutex() noexcept {
+  static std::recursive_mutex mutex;
+  return mutex;
+}
+} // namespace fre2d
+#endif // FRE2D_HEADLESS
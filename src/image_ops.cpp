@@ -0,0 +1,265 @@
+// MIT License
+//
+// Copyright (c) 2025 Ferhat Geçdoğan All Rights Reserved.
+// Distributed under the terms of the MIT License.
+//
+#include <image_ops.hpp>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  define FRE2D_IMAGE_OPS_SSE2
+#  include <emmintrin.h>
+#  if defined(__AVX2__)
+#    define FRE2D_IMAGE_OPS_AVX2
+#    include <immintrin.h>
+#  endif
+#elif defined(__ARM_NEON)
+#  define FRE2D_IMAGE_OPS_NEON
+#  include <arm_neon.h>
+#endif
+
+namespace fre2d {
+namespace {
+// rows are handled in pairs (y, height - 1 - y): both are loaded before
+// either is stored, so flipping works in place without row buffer.
+struct RowPair {
+  const std::uint8_t* source_a;
+  std::uint8_t* destination_a;
+  const std::uint8_t* source_b;
+  std::uint8_t* destination_b;
+};
+
+// c * a / 255, rounded.
+[[nodiscard]] std::uint8_t multiply_alpha(std::uint8_t c, std::uint8_t a) noexcept {
+  const unsigned t { c * static_cast<unsigned>(a) + 128u };
+  return static_cast<std::uint8_t>((t + (t >> 8)) >> 8);
+}
+
+void process_pixel(std::uint8_t* pixel, int channels, const ImageOps& ops) noexcept {
+  if(ops.swap_red_blue) {
+    std::swap(pixel[0], pixel[2]);
+  }
+  if(ops.premultiply_alpha && channels == 4) {
+    for(int c = 0; c < 3; ++c) {
+      pixel[c] = multiply_alpha(pixel[c], pixel[3]);
+    }
+  }
+}
+
+// pixels [first, width) of row pair.
+void process_pixels_scalar(const RowPair& rows, std::size_t first, std::size_t width, int channels, const ImageOps& ops) noexcept {
+  const auto stride = static_cast<std::size_t>(channels);
+  for(std::size_t x = first; x < width; ++x) {
+    std::uint8_t a[4], b[4];
+    std::memcpy(a, rows.source_a + x * stride, stride);
+    std::memcpy(b, rows.source_b + x * stride, stride);
+    process_pixel(a, channels, ops);
+    process_pixel(b, channels, ops);
+    std::memcpy(rows.destination_a + x * stride, a, stride);
+    std::memcpy(rows.destination_b + x * stride, b, stride);
+  }
+}
+
+#if defined(FRE2D_IMAGE_OPS_SSE2)
+// 4 RGBA pixels.
+template<bool Premultiply, bool Swap>
+[[nodiscard]] __m128i process_sse2(__m128i pixels) noexcept {
+  if constexpr(Swap) {
+    pixels = _mm_or_si128(
+      _mm_and_si128(pixels, _mm_set1_epi32(static_cast<int>(0xFF00FF00u))),
+      _mm_or_si128(
+        _mm_and_si128(_mm_srli_epi32(pixels, 16), _mm_set1_epi32(0xFF)),
+        _mm_slli_epi32(_mm_and_si128(pixels, _mm_set1_epi32(0xFF)), 16)
+      )
+    );
+  }
+  if constexpr(Premultiply) {
+    const auto zero = _mm_setzero_si128();
+    const auto multiply = [](__m128i channels) {
+      const auto alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(channels, 0xFF), 0xFF);
+      const auto t = _mm_add_epi16(_mm_mullo_epi16(channels, alpha), _mm_set1_epi16(128));
+      return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+    };
+    const auto multiplied = _mm_packus_epi16(
+      multiply(_mm_unpacklo_epi8(pixels, zero)),
+      multiply(_mm_unpackhi_epi8(pixels, zero))
+    );
+    const auto alpha_mask = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+    pixels = _mm_or_si128(_mm_andnot_si128(alpha_mask, multiplied), _mm_and_si128(pixels, alpha_mask));
+  }
+  return pixels;
+}
+#endif
+
+#if defined(FRE2D_IMAGE_OPS_AVX2)
+// 8 RGBA pixels; same as process_sse2(), unpack and pack work per 128-bit lane.
+template<bool Premultiply, bool Swap>
+[[nodiscard]] __m256i process_avx2(__m256i pixels) noexcept {
+  if constexpr(Swap) {
+    pixels = _mm256_or_si256(
+      _mm256_and_si256(pixels, _mm256_set1_epi32(static_cast<int>(0xFF00FF00u))),
+      _mm256_or_si256(
+        _mm256_and_si256(_mm256_srli_epi32(pixels, 16), _mm256_set1_epi32(0xFF)),
+        _mm256_slli_epi32(_mm256_and_si256(pixels, _mm256_set1_epi32(0xFF)), 16)
+      )
+    );
+  }
+  if constexpr(Premultiply) {
+    const auto zero = _mm256_setzero_si256();
+    const auto multiply = [](__m256i channels) {
+      const auto alpha = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(channels, 0xFF), 0xFF);
+      const auto t = _mm256_add_epi16(_mm256_mullo_epi16(channels, alpha), _mm256_set1_epi16(128));
+      return _mm256_srli_epi16(_mm256_add_epi16(t, _mm256_srli_epi16(t, 8)), 8);
+    };
+    const auto multiplied = _mm256_packus_epi16(
+      multiply(_mm256_unpacklo_epi8(pixels, zero)),
+      multiply(_mm256_unpackhi_epi8(pixels, zero))
+    );
+    const auto alpha_mask = _mm256_set1_epi32(static_cast<int>(0xFF000000u));
+    pixels = _mm256_or_si256(_mm256_andnot_si256(alpha_mask, multiplied), _mm256_and_si256(pixels, alpha_mask));
+  }
+  return pixels;
+}
+#endif
+
+// returns number of processed pixels of RGBA row pair.
+template<bool Premultiply, bool Swap>
+std::size_t process_rgba_simd(const RowPair& rows, std::size_t width) noexcept {
+  std::size_t x { 0 };
+#if defined(FRE2D_IMAGE_OPS_AVX2)
+  for(; x + 8 <= width; x += 8) {
+    const auto a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rows.source_a + x * 4));
+    const auto b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rows.source_b + x * 4));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(rows.destination_a + x * 4), process_avx2<Premultiply, Swap>(a));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(rows.destination_b + x * 4), process_avx2<Premultiply, Swap>(b));
+  }
+#endif
+#if defined(FRE2D_IMAGE_OPS_SSE2)
+  for(; x + 4 <= width; x += 4) {
+    const auto a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rows.source_a + x * 4));
+    const auto b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rows.source_b + x * 4));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(rows.destination_a + x * 4), process_sse2<Premultiply, Swap>(a));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(rows.destination_b + x * 4), process_sse2<Premultiply, Swap>(b));
+  }
+#elif defined(FRE2D_IMAGE_OPS_NEON)
+  const auto process = [](uint8x16x4_t pixels) {
+    if constexpr(Swap) {
+      std::swap(pixels.val[0], pixels.val[2]);
+    }
+    if constexpr(Premultiply) {
+      for(int c = 0; c < 3; ++c) {
+        // vraddhn(t, (t + 128) >> 8) is (t + 128 + ((t + 128) >> 8)) >> 8; c * a / 255 rounded.
+        const auto lo = vmull_u8(vget_low_u8(pixels.val[c]), vget_low_u8(pixels.val[3]));
+        const auto hi = vmull_u8(vget_high_u8(pixels.val[c]), vget_high_u8(pixels.val[3]));
+        pixels.val[c] = vcombine_u8(vraddhn_u16(lo, vrshrq_n_u16(lo, 8)), vraddhn_u16(hi, vrshrq_n_u16(hi, 8)));
+      }
+    }
+    return pixels;
+  };
+  for(; x + 16 <= width; x += 16) {
+    const auto a = vld4q_u8(rows.source_a + x * 4);
+    const auto b = vld4q_u8(rows.source_b + x * 4);
+    vst4q_u8(rows.destination_a + x * 4, process(a));
+    vst4q_u8(rows.destination_b + x * 4, process(b));
+  }
+#else
+  static_cast<void>(rows);
+  static_cast<void>(width);
+#endif
+  return x;
+}
+
+// flip only: rows are moved as bytes, whatever channels are.
+void copy_bytes_simd(const RowPair& rows, std::size_t size) noexcept {
+  std::size_t i { 0 };
+#if defined(FRE2D_IMAGE_OPS_SSE2)
+  for(; i + 16 <= size; i += 16) {
+    const auto a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rows.source_a + i));
+    const auto b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rows.source_b + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(rows.destination_a + i), a);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(rows.destination_b + i), b);
+  }
+#elif defined(FRE2D_IMAGE_OPS_NEON)
+  for(; i + 16 <= size; i += 16) {
+    const auto a = vld1q_u8(rows.source_a + i);
+    const auto b = vld1q_u8(rows.source_b + i);
+    vst1q_u8(rows.destination_a + i, a);
+    vst1q_u8(rows.destination_b + i, b);
+  }
+#endif
+  for(; i < size; ++i) {
+    const auto a = rows.source_a[i], b = rows.source_b[i];
+    rows.destination_a[i] = a;
+    rows.destination_b[i] = b;
+  }
+}
+
+template<typename ProcessRows>
+void for_each_row_pair(const std::uint8_t* source,
+                       std::uint8_t* destination,
+                       std::uint32_t height,
+                       std::size_t row_size,
+                       bool flip_vertically,
+                       ProcessRows&& process_rows) noexcept {
+  for(std::uint32_t y = 0; y < (height + 1) / 2; ++y) {
+    const std::size_t top { y * row_size }, bottom { (height - 1 - y) * row_size };
+    process_rows(RowPair{
+      source + top,
+      destination + (flip_vertically ? bottom : top),
+      source + bottom,
+      destination + (flip_vertically ? top : bottom)
+    });
+  }
+}
+} // anonymous namespace
+
+void process_image(const std::uint8_t* source,
+                   std::uint8_t* destination,
+                   std::uint32_t width,
+                   std::uint32_t height,
+                   int channels,
+                   const ImageOps& ops) noexcept {
+  const bool premultiply { ops.premultiply_alpha && channels == 4 };
+  const std::size_t row_size { static_cast<std::size_t>(width) * channels };
+  if(!premultiply && !ops.swap_red_blue) {
+    if(source == destination && !ops.flip_vertically) {
+      return;
+    }
+    for_each_row_pair(source, destination, height, row_size, ops.flip_vertically, [row_size](const RowPair& rows) {
+      copy_bytes_simd(rows, row_size);
+    });
+    return;
+  }
+  if(channels != 4) {
+    process_image_scalar(source, destination, width, height, channels, ops);
+    return;
+  }
+  const auto process = [&](auto premultiply_tag, auto swap_tag) {
+    for_each_row_pair(source, destination, height, row_size, ops.flip_vertically, [&](const RowPair& rows) {
+      const auto first = process_rgba_simd<decltype(premultiply_tag)::value, decltype(swap_tag)::value>(rows, width);
+      process_pixels_scalar(rows, first, width, channels, ops);
+    });
+  };
+  if(premultiply && ops.swap_red_blue) {
+    process(std::true_type{}, std::true_type{});
+  } else if(premultiply) {
+    process(std::true_type{}, std::false_type{});
+  } else {
+    process(std::false_type{}, std::true_type{});
+  }
+}
+
+void process_image_scalar(const std::uint8_t* source,
+                          std::uint8_t* destination,
+                          std::uint32_t width,
+                          std::uint32_t height,
+                          int channels,
+                          const ImageOps& ops) noexcept {
+  const std::size_t row_size { static_cast<std::size_t>(width) * channels };
+  for_each_row_pair(source, destination, height, row_size, ops.flip_vertically, [&](const RowPair& rows) {
+    process_pixels_scalar(rows, 0, width, channels, ops);
+  });
+}
+} // namespace fre2d
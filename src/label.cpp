@@ -6,6 +6,7 @@
 #include <camera.hpp>
 #include <chrono>
 #include <label.hpp>
+#include <profiler.hpp>
 
 #include "../include/helper_funcs.hpp"
 #include <renderer.hpp>
@@ -108,11 +109,20 @@ void Label::before_draw(const Shader &shader,
 
 void Label::draw(const Shader &shader, const std::unique_ptr<Camera> &cam,
                  const std::unique_ptr<LightManager> &lm) noexcept {
+  // deferred shader is still compiling; skip this draw instead of stalling.
+  if(!shader.is_ready() || !this->_font) {
+    return;
+  }
+  ProfileScope scope("Label::draw");
   glm::vec2 pos = this->_position;
   this->before_draw(shader, cam, lm);
   glActiveTexture(GL_TEXTURE0);
   for (const auto &c : this->_text) {
-    const auto &character = this->_font._char_map[c];
+    const auto found = this->_font->_char_map.find(c);
+    if(found == this->_font->_char_map.end()) {
+      continue; // not loaded; same as empty glyph.
+    }
+    const auto &character = found->second;
     float xpos = pos.x + static_cast<float>(character.bearing.x);
     float ypos = pos.y - static_cast<float>(character.size.y - character.bearing.y);
     const auto w = static_cast<float>(character.size.x);
@@ -168,6 +178,8 @@ void Label::before_draw(const Shader &shader,
   shader.set_bool("FlipVertically", this->_flip_vertically);
   shader.set_bool("FlipHorizontally", this->_flip_horizontally);
   shader.set_bool("AffectedByLight", this->_affected_by_light);
+  shader.set_float("Emissive", this->_emissive);
+  shader.set_bool("PremultipliedAlpha", Renderer::get_blend_mode() == BlendModePremultiplied);
   lm->get_point_lights_ssbo().bind();
   lm->update_buffers();
   shader.set_float_vec4("global_ambient_light.color", lm->get_ambient_light().get_color());
@@ -193,7 +205,7 @@ void Label::_initialize_fields_other_than_color(
   bool flip_horizontally
 ) noexcept {
   this->_scale = {1.f, 1.f, 0.f};
-  this->_font = font;
+  this->_font = &font;
   this->_text = text;
   this->_position = position;
   this->_rotation_rads = rotation_rads;
@@ -204,7 +216,7 @@ void Label::_initialize_fields_other_than_color(
   this->_bbox_h = 0;
 
   for (const auto &ch : this->_text) {
-    const auto &glyph = this->_font._face->glyph;
+    const auto &glyph = this->_font->_face->glyph;
     this->_bbox_w += glyph->advance.x >> 6;
     this->_bbox_h =
         std::max(this->_bbox_h, static_cast<GLfloat>(glyph->bitmap_top));
@@ -4,6 +4,8 @@
 // Distributed under the terms of the MIT License.
 //
 #include <light_manager.hpp>
+#include <gpu_memory_tracker.hpp>
+#include <profiler.hpp>
 #include <iostream>
 
 namespace fre2d {
@@ -22,12 +24,18 @@ void LightManager::update_buffers() noexcept {
     return;
 
   this->_point_lights_modified = false;
+  ProfileScope scope("LightManager::update_buffers");
 
   if(this->_point_lights_diff != 0) {
     this->_point_light_ssbo.bind();
     glBufferData(GL_SHADER_STORAGE_BUFFER,
                  sizeof(PointLight) * this->_point_lights.size(),
                  this->_point_lights.data(), GL_DYNAMIC_DRAW);
+    GpuMemoryTracker::get().track(
+      GpuMemoryClassStorageBuffer,
+      this->_point_light_ssbo.get_handle().value,
+      sizeof(PointLight) * this->_point_lights.size()
+    );
     this->_point_lights_diff = 0;
     return;
   }
@@ -31,11 +31,11 @@ Mesh::Mesh(const std::vector<Vertex>& vertices,
   return this->_ebo;
 }
 
-[[nodiscard]] const std::optional<Texture>& Mesh::get_texture() const noexcept {
+[[nodiscard]] const std::optional<TextureHandle>& Mesh::get_texture() const noexcept {
   return this->_texture;
 }
 
-[[nodiscard]] std::optional<Texture>& Mesh::get_texture_mutable() noexcept {
+[[nodiscard]] std::optional<TextureHandle>& Mesh::get_texture_mutable() noexcept {
   return this->_texture;
 }
 
@@ -55,7 +55,7 @@ void Mesh::initialize(const std::vector<Vertex>& vertices,
   this->_vertices = vertices;
 
   if(texture != Texture::get_default_texture())
-    this->_texture = texture;
+    this->_texture = texture.get_handle();
 
   // position attribute (x, y)
   glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)0);
@@ -68,5 +68,9 @@ void Mesh::initialize(const std::vector<Vertex>& vertices,
   // texture coordinate attribute (x, y)
   glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)(6 * sizeof(float)));
   glEnableVertexAttribArray(2);
+
+  // texture array layer attribute (layer)
+  glVertexAttribPointer(3, 1, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)(8 * sizeof(float)));
+  glEnableVertexAttribArray(3);
 }
 } // namespace fre2d
\ No newline at end of file
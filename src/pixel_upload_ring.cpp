@@ -0,0 +1,203 @@
+// MIT License
+//
+// Copyright (c) 2025 Ferhat Geçdoğan All Rights Reserved.
+// Distributed under the terms of the MIT License.
+//
+#include <pixel_upload_ring.hpp>
+#include <iostream>
+#include <limits>
+
+namespace fre2d {
+namespace {
+[[nodiscard]] GLenum format_of(int channels) noexcept {
+  switch(channels) {
+  case FormatRed: case 1: { return GL_RED; }
+  case FormatGreen: { return GL_GREEN; }
+  case FormatBlue: { return GL_BLUE; }
+  case FormatRgb: { return GL_RGB; }
+  default: { return GL_RGBA; }
+  }
+}
+} // anonymous namespace
+
+PixelUploadRing::PixelUploadRing(std::size_t capacity) noexcept
+  : _buffer_id{0}, _mapped{nullptr}, _capacity{capacity}, _head{0}, _used{0} {
+  if(capacity == 0) {
+    return;
+  }
+  // coherent: worker writes are visible to gl without explicit flush, since
+  // upload is always issued after writing thread is done (synchronized by caller).
+  constexpr GLbitfield flags { GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT };
+  glCreateBuffers(1, &this->_buffer_id);
+  glNamedBufferStorage(this->_buffer_id, static_cast<GLsizeiptr>(capacity), nullptr, flags);
+  this->_mapped = static_cast<unsigned char*>(
+    glMapNamedBufferRange(this->_buffer_id, 0, static_cast<GLsizeiptr>(capacity), flags)
+  );
+  if(!this->_mapped) {
+    std::cout << "fre2d error: PixelUploadRing: cannot map pixel unpack buffer, uploads use client memory.\n";
+  }
+}
+
+PixelUploadRing::~PixelUploadRing() noexcept {
+  for(auto& region: this->_regions) {
+    if(region.fence) {
+      glClientWaitSync(region.fence, GL_SYNC_FLUSH_COMMANDS_BIT, std::numeric_limits<GLuint64>::max());
+      glDeleteSync(region.fence);
+    }
+  }
+  if(this->_buffer_id != 0) {
+    if(this->_mapped) {
+      glUnmapNamedBuffer(this->_buffer_id);
+    }
+    glDeleteBuffers(1, &this->_buffer_id);
+  }
+}
+
+[[nodiscard]] UploadSpan PixelUploadRing::allocate(std::size_t size) noexcept {
+  constexpr auto alignment = detail::pixel_upload_ring::allocation_alignment;
+  const std::size_t aligned_size { (size + alignment - 1) / alignment * alignment };
+  std::lock_guard lock(this->_mutex);
+  if(!this->_mapped || size == 0 || aligned_size > this->_capacity) {
+    return UploadSpan{nullptr, 0, 0};
+  }
+  this->_pop_finished_locked();
+  if(this->_used == 0) {
+    this->_head = 0; // empty; start over instead of wrapping later.
+  }
+
+  std::size_t offset { this->_head };
+  std::size_t bytes { aligned_size };
+  if(this->_head + aligned_size > this->_capacity) {
+    // not enough room till end; skip tail of buffer and continue from start.
+    offset = 0;
+    bytes += this->_capacity - this->_head;
+  }
+  if(this->_used + bytes > this->_capacity) {
+    return UploadSpan{nullptr, 0, 0};
+  }
+  this->_head = offset + aligned_size;
+  this->_used += bytes;
+  this->_regions.push_back(Region{offset, bytes, nullptr, false});
+  return UploadSpan{this->_mapped + offset, offset, size};
+}
+
+void PixelUploadRing::release(const UploadSpan& span) noexcept {
+  if(span.data) {
+    this->_submit(span.offset, nullptr);
+  }
+}
+
+void PixelUploadRing::upload(const UploadSpan& span,
+                             Texture& texture,
+                             GLsizei width,
+                             GLsizei height,
+                             bool use_nearest,
+                             bool use_mipmap,
+                             const Texture::WrapOptions& texture_wrap,
+                             int channels) noexcept {
+  if(!span.data) {
+    std::cout << "fre2d error: PixelUploadRing::upload(): span is empty.\n";
+    return;
+  }
+  // while unpack buffer is bound, data pointer is offset into it; so
+  // load_from_data() does exactly same work, but gpu copies from our buffer.
+  glBindBuffer(GL_PIXEL_UNPACK_BUFFER, this->_buffer_id);
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 1); // rows are tightly packed (RGB too).
+  texture.load_from_data(
+    reinterpret_cast<const unsigned char*>(span.offset),
+    width,
+    height,
+    use_nearest,
+    use_mipmap,
+    texture_wrap,
+    channels
+  );
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+  glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+  this->_submit(span.offset, glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+}
+
+void PixelUploadRing::stream(const UploadSpan& span,
+                             const Texture& texture,
+                             GLsizei width,
+                             GLsizei height,
+                             int channels,
+                             GLint x_offset,
+                             GLint y_offset) noexcept {
+  if(!span.data) {
+    std::cout << "fre2d error: PixelUploadRing::stream(): span is empty.\n";
+    return;
+  }
+  glBindBuffer(GL_PIXEL_UNPACK_BUFFER, this->_buffer_id);
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+  glTextureSubImage2D(
+    texture.get_texture_id(),
+    0,
+    x_offset,
+    y_offset,
+    width,
+    height,
+    format_of(channels),
+    GL_UNSIGNED_BYTE,
+    reinterpret_cast<const void*>(span.offset)
+  );
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+  glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+  this->_submit(span.offset, glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+}
+
+void PixelUploadRing::reclaim() noexcept {
+  std::lock_guard lock(this->_mutex);
+  for(auto& region: this->_regions) {
+    if(!region.submitted) {
+      break; // still being written; later ones can't be reused before it anyway.
+    }
+    if(!region.fence) {
+      continue;
+    }
+    // flush bit makes sure fence is submitted, so zero timeout can see it signaled.
+    const auto status = glClientWaitSync(region.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+    if(status == GL_TIMEOUT_EXPIRED) {
+      break;
+    }
+    glDeleteSync(region.fence);
+    region.fence = nullptr;
+  }
+  this->_pop_finished_locked();
+}
+
+[[nodiscard]] bool PixelUploadRing::is_mapped() const noexcept {
+  return this->_mapped != nullptr;
+}
+
+[[nodiscard]] const std::size_t& PixelUploadRing::get_capacity() const noexcept {
+  return this->_capacity;
+}
+
+[[nodiscard]] std::size_t PixelUploadRing::get_used_bytes() const noexcept {
+  std::lock_guard lock(this->_mutex);
+  return this->_used;
+}
+
+void PixelUploadRing::_submit(std::size_t offset, GLsync fence) noexcept {
+  std::lock_guard lock(this->_mutex);
+  for(auto& region: this->_regions) {
+    if(!region.submitted && region.offset == offset) {
+      region.fence = fence;
+      region.submitted = true;
+      return;
+    }
+  }
+  std::cout << "fre2d error: PixelUploadRing: span at offset " << offset << " is not allocated.\n";
+  if(fence) {
+    glDeleteSync(fence);
+  }
+}
+
+void PixelUploadRing::_pop_finished_locked() noexcept {
+  while(!this->_regions.empty() && this->_regions.front().submitted && !this->_regions.front().fence) {
+    this->_used -= this->_regions.front().bytes;
+    this->_regions.pop_front();
+  }
+}
+} // namespace fre2d
@@ -4,6 +4,7 @@
 // Distributed under the terms of the MIT License.
 //
 #include <polygon.hpp>
+#include <profiler.hpp>
 #include <renderer.hpp>
 #include <iostream>
 
@@ -177,6 +178,11 @@ void Polygon::draw(const Shader &shader,
 
 void Polygon::draw(const Shader &shader, const std::unique_ptr<Camera> &cam,
                    const std::unique_ptr<LightManager> &lm) noexcept {
+  // deferred shader is still compiling; skip this draw instead of stalling.
+  if(!shader.is_ready()) {
+    return;
+  }
+  ProfileScope scope("Polygon::draw");
   this->before_draw(shader, cam, lm);
   shader.use();
   this->_mesh.get_vao().bind();
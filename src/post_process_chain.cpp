@@ -0,0 +1,260 @@
+// MIT License
+//
+// Copyright (c) 2025 Ferhat Geçdoğan All Rights Reserved.
+// Distributed under the terms of the MIT License.
+//
+#include <post_process_chain.hpp>
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <string_view>
+
+namespace fre2d {
+namespace {
+[[nodiscard]] bool is_identifier_char(char ch) noexcept {
+  return std::isalnum(static_cast<unsigned char>(ch)) || ch == '_';
+}
+
+// true if [pos, pos + size) is a whole identifier, not a part of longer one.
+[[nodiscard]] bool is_whole_identifier(std::string_view source, std::size_t pos, std::size_t size) noexcept {
+  return (pos == 0 || !is_identifier_char(source[pos - 1])) &&
+         (pos + size == source.size() || !is_identifier_char(source[pos + size]));
+}
+
+// fre2d_effect is renamed, fre2d_effect_strength is not.
+void rename_identifier(std::string& source, std::string_view from, std::string_view to) noexcept {
+  for(auto pos = source.find(from); pos != std::string::npos; pos = source.find(from, pos)) {
+    if(!is_whole_identifier(source, pos, from.size())) {
+      pos += from.size();
+      continue;
+    }
+    source.replace(pos, from.size(), to);
+    pos += to.size();
+  }
+}
+
+// last identifier of declarator like "float Strength[4] = ...".
+[[nodiscard]] std::string get_declarator_name(std::string_view declarator) noexcept {
+  declarator = declarator.substr(0, std::min(declarator.find('='), declarator.find('[')));
+  auto end = declarator.size();
+  while(end > 0 && !is_identifier_char(declarator[end - 1])) {
+    --end;
+  }
+  auto begin = end;
+  while(begin > 0 && is_identifier_char(declarator[begin - 1])) {
+    --begin;
+  }
+  return std::string(declarator.substr(begin, end - begin));
+}
+
+// names of global uniforms declared in source; uniform blocks give their
+// block name. comments are not skipped, so commented out ones count too.
+[[nodiscard]] std::vector<std::string> get_uniform_names(std::string_view source) noexcept {
+  static constexpr std::string_view keyword { "uniform" };
+  std::vector<std::string> names;
+  for(auto pos = source.find(keyword); pos != std::string_view::npos; pos = source.find(keyword, pos)) {
+    if(!is_whole_identifier(source, pos, keyword.size())) {
+      pos += keyword.size();
+      continue;
+    }
+    pos += keyword.size();
+    const auto semicolon = source.find(';', pos);
+    if(semicolon == std::string_view::npos) {
+      break;
+    }
+    if(const auto brace = source.find('{', pos); brace < semicolon) {
+      names.push_back(get_declarator_name(source.substr(pos, brace - pos)));
+      pos = source.find('}', brace);
+      continue;
+    }
+    // declarators are split on commas outside of parentheses, e.g.
+    // "uniform vec3 A = vec3(1.0, 0.0, 0.0), B;".
+    std::size_t begin { pos };
+    int depth { 0 };
+    for(auto i = pos; i <= semicolon; ++i) {
+      if(source[i] == '(') {
+        ++depth;
+      } else if(source[i] == ')') {
+        --depth;
+      } else if((source[i] == ',' && depth == 0) || i == semicolon) {
+        if(auto name = get_declarator_name(source.substr(begin, i - begin)); !name.empty()) {
+          names.push_back(std::move(name));
+        }
+        begin = i + 1;
+      }
+    }
+    pos = semicolon;
+  }
+  return names;
+}
+} // anonymous namespace
+
+PostProcessChain::PostProcessChain(RenderTargetPool& pool) noexcept
+  : _pool{pool},
+    _target_desc{{ColorRgba8}, DepthStencilNone},
+    _fusion_enabled{detail::post_process_chain::default_fusion_enabled},
+    _dirty{true} {}
+
+void PostProcessChain::push_pass(const PostProcessPass& pass) noexcept {
+  this->_passes.push_back(pass);
+  this->_dirty = true;
+}
+
+void PostProcessChain::clear() noexcept {
+  this->_passes.clear();
+  this->_stages.clear();
+  this->_dirty = true;
+}
+
+void PostProcessChain::set_fusion_enabled(bool fusion_enabled) noexcept {
+  if(this->_fusion_enabled != fusion_enabled) {
+    this->_fusion_enabled = fusion_enabled;
+    this->_dirty = true;
+  }
+}
+
+void PostProcessChain::set_target_desc(const RenderTargetDesc& desc) noexcept {
+  this->_target_desc = desc;
+}
+
+void PostProcessChain::compile() noexcept {
+  this->_stages.clear();
+  std::vector<std::size_t> per_pixel_run;
+  std::vector<std::string> run_uniform_names;
+  const auto flush_per_pixel_run = [this, &per_pixel_run, &run_uniform_names] {
+    if(per_pixel_run.empty()) {
+      return;
+    }
+    const auto source = PostProcessChain::_generate_fused_source(this->_passes, per_pixel_run);
+    this->_stages.push_back(Stage{
+      Shader(detail::framebuffer::default_vertex, source.c_str()),
+      per_pixel_run
+    });
+    per_pixel_run.clear();
+    run_uniform_names.clear();
+  };
+
+  for(std::size_t i = 0; i < this->_passes.size(); ++i) {
+    if(this->_passes[i].kind == PassPerPixel) {
+      // same uniform in two passes would be redeclared in fused program, and
+      // set_uniforms of both would write into it; so pass starts a new one.
+      const auto uniform_names = get_uniform_names(this->_passes[i].source);
+      if(std::any_of(uniform_names.begin(), uniform_names.end(), [&run_uniform_names](const std::string& name) {
+           return std::find(run_uniform_names.begin(), run_uniform_names.end(), name) != run_uniform_names.end();
+         })) {
+        flush_per_pixel_run();
+      }
+      run_uniform_names.insert(run_uniform_names.end(), uniform_names.begin(), uniform_names.end());
+      per_pixel_run.push_back(i);
+      if(!this->_fusion_enabled) {
+        flush_per_pixel_run();
+      }
+      continue;
+    }
+    flush_per_pixel_run();
+    this->_stages.push_back(Stage{
+      Shader(detail::framebuffer::default_vertex, this->_passes[i].source.c_str()),
+      {i}
+    });
+  }
+  flush_per_pixel_run();
+  if(this->_stages.empty()) {
+    // fused program of no passes just copies input into output.
+    const auto source = PostProcessChain::_generate_fused_source(this->_passes, {});
+    this->_stages.push_back(Stage{
+      Shader(detail::framebuffer::default_vertex, source.c_str()),
+      {}
+    });
+  }
+
+  for(const auto& stage: this->_stages) {
+    stage.shader.set_int("ScreenTexture", 0);
+  }
+  this->_dirty = false;
+}
+
+void PostProcessChain::apply(Framebuffer& input, Framebuffer* output) noexcept {
+  if(this->_dirty) {
+    this->compile();
+  }
+
+  std::array<Framebuffer*, 2> ping_pong { nullptr, nullptr };
+  const auto target_count = std::min<std::size_t>(this->_stages.size() - 1, ping_pong.size());
+  for(std::size_t i = 0; i < target_count; ++i) {
+    ping_pong[i] = &this->_pool.acquire(input.get_width(), input.get_height(), this->_target_desc);
+  }
+
+  // pooled targets keep previous frame's pixels; with app's blending on,
+  // effects that output alpha < 1 would be composited over them. so they are
+  // overwritten, and app's blend state is restored for last pass.
+  const bool blend_enabled { glIsEnabled(GL_BLEND) == GL_TRUE };
+  glDisable(GL_BLEND);
+
+  Framebuffer* source { &input };
+  for(std::size_t i = 0; i < this->_stages.size(); ++i) {
+    const auto& stage = this->_stages[i];
+    for(const auto& pass_index: stage.pass_indices) {
+      if(this->_passes[pass_index].set_uniforms) {
+        this->_passes[pass_index].set_uniforms(stage.shader);
+      }
+    }
+    const bool is_last { i + 1 == this->_stages.size() };
+    if(is_last && blend_enabled) {
+      glEnable(GL_BLEND);
+    }
+    Framebuffer* target { is_last ? output : ping_pong[i % ping_pong.size()] };
+    if(target) {
+      target->call([&] {
+        source->render_texture(stage.shader);
+      });
+    } else {
+      glBindFramebuffer(GL_FRAMEBUFFER, 0);
+      glViewport(0, 0, input.get_width(), input.get_height());
+      source->render_texture(stage.shader);
+    }
+    source = target;
+  }
+
+  for(std::size_t i = 0; i < target_count; ++i) {
+    this->_pool.release(*ping_pong[i]);
+  }
+}
+
+[[nodiscard]] const std::vector<PostProcessPass>& PostProcessChain::get_passes() const noexcept {
+  return this->_passes;
+}
+
+[[nodiscard]] std::size_t PostProcessChain::get_program_count() const noexcept {
+  return this->_stages.size();
+}
+
+[[nodiscard]] const bool& PostProcessChain::get_fusion_enabled() const noexcept {
+  return this->_fusion_enabled;
+}
+
+// every per-pixel pass gets its own copy of fre2d_effect with index suffix,
+// then main() calls them in order; so N passes cost one texture fetch and one
+// fullscreen draw instead of N.
+[[nodiscard]] std::string PostProcessChain::_generate_fused_source(
+  const std::vector<PostProcessPass>& passes,
+  const std::vector<std::size_t>& pass_indices
+) noexcept {
+  const std::string effect_name { detail::post_process_chain::effect_function_name };
+  std::string source { detail::post_process_chain::per_pixel_header };
+  std::string calls;
+  for(std::size_t i = 0; i < pass_indices.size(); ++i) {
+    const auto renamed = effect_name + "_" + std::to_string(i);
+    auto pass_source = passes[pass_indices[i]].source;
+    rename_identifier(pass_source, effect_name, renamed);
+    source += pass_source;
+    source += '\n';
+    calls += "  color = " + renamed + "(color, TexCoords);\n";
+  }
+  source += "void main() {\n"
+            "  vec4 color = texture(ScreenTexture, TexCoords);\n";
+  source += calls;
+  source += "  FragColor = color * Color;\n"
+            "}\n";
+  return source;
+}
+} // namespace fre2d
@@ -0,0 +1,237 @@
+// MIT License
+//
+// Copyright (c) 2025 Ferhat Geçdoğan All Rights Reserved.
+// Distributed under the terms of the MIT License.
+//
+#include <profiler.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <utility>
+
+namespace fre2d {
+namespace {
+// queries are generated in batches; one glGenQueries per 64 scopes at most.
+constexpr GLsizei query_batch { 64 };
+
+[[nodiscard]] std::int64_t now_ns() noexcept {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()
+  ).count();
+}
+} // anonymous namespace
+
+Profiler::Profiler() noexcept
+  : _history(detail::profiler::default_history),
+    _history_head{0},
+    _history_count{0},
+    _frame_count{0},
+    _frame_begin_ns{now_ns()},
+    _depth{0},
+    _scope_generation{0},
+    _enabled{false},
+    _gpu_timing{true} {}
+
+[[nodiscard]] Profiler& Profiler::get() noexcept {
+  thread_local Profiler profiler;
+  return profiler;
+}
+
+void Profiler::set_enabled(bool enabled, bool gpu_timing) noexcept {
+  if(enabled && !this->_enabled) {
+    // time spent disabled is not part of the first frame.
+    this->_frame_begin_ns = now_ns();
+  }
+  this->_enabled = enabled;
+  this->_gpu_timing = gpu_timing;
+}
+
+void Profiler::set_history(std::size_t history) noexcept {
+  this->_history.assign(std::max<std::size_t>(history, 1), ProfileFrame{});
+  this->_history_head = 0;
+  this->_history_count = 0;
+}
+
+void Profiler::end_frame() noexcept {
+  const auto now = now_ns();
+  if(!this->_records.empty()) {
+    // scopes still open (e.g. one spanning end_frame()) end here.
+    for(auto& record: this->_records) {
+      if(record.cpu_end_ns == 0) {
+        record.cpu_end_ns = now;
+        if(record.begin_query != 0) {
+          record.end_query = this->_acquire_query();
+          glQueryCounter(record.end_query, GL_TIMESTAMP);
+        }
+      }
+    }
+    this->_pending.push_back(PendingFrame {
+      this->_frame_count,
+      static_cast<double>(now - this->_frame_begin_ns) / 1e6,
+      std::move(this->_records)
+    });
+    this->_records.clear();
+    if(!this->_spare_records.empty()) {
+      this->_records = std::move(this->_spare_records.back());
+      this->_spare_records.pop_back();
+    }
+  }
+  this->_frame_begin_ns = now;
+  this->_depth = 0;
+  this->_scope_generation = (this->_scope_generation + 1) & detail::profiler::scope_generation_mask;
+  ++this->_frame_count;
+
+  while(!this->_pending.empty()) {
+    auto& frame = this->_pending.front();
+    if(this->_frame_count - frame.frame_index < detail::profiler::default_latency || !this->_is_available(frame)) {
+      break; // later frames can't be done before this one.
+    }
+    this->_resolve(frame);
+    frame.records.clear();
+    this->_spare_records.push_back(std::move(frame.records));
+    this->_pending.pop_front();
+  }
+}
+
+void Profiler::clear() noexcept {
+  std::vector<GLuint> queries { std::move(this->_free_queries) };
+  const auto collect = [&queries](const std::vector<ScopeRecord>& records) {
+    for(const auto& record: records) {
+      for(const GLuint query_id: { record.begin_query, record.end_query }) {
+        if(query_id != 0) {
+          queries.push_back(query_id);
+        }
+      }
+    }
+  };
+  collect(this->_records);
+  for(const auto& frame: this->_pending) {
+    collect(frame.records);
+  }
+  if(!queries.empty()) {
+    glDeleteQueries(static_cast<GLsizei>(queries.size()), queries.data());
+  }
+  this->_free_queries.clear();
+  this->_records.clear();
+  this->_pending.clear();
+  this->_spare_records.clear();
+  this->_depth = 0;
+  this->_scope_generation = (this->_scope_generation + 1) & detail::profiler::scope_generation_mask;
+}
+
+[[nodiscard]] const ProfileFrame* Profiler::get_frame(std::size_t frames_ago) const noexcept {
+  if(frames_ago >= this->_history_count) {
+    return nullptr;
+  }
+  const auto size = this->_history.size();
+  return &this->_history[(this->_history_head + size - 1 - frames_ago) % size];
+}
+
+[[nodiscard]] std::size_t Profiler::get_frame_count() const noexcept {
+  return this->_history_count;
+}
+
+[[nodiscard]] std::size_t Profiler::get_pending_count() const noexcept {
+  return this->_pending.size();
+}
+
+[[nodiscard]] const bool& Profiler::is_enabled() const noexcept {
+  return this->_enabled;
+}
+
+[[nodiscard]] const bool& Profiler::is_gpu_timing() const noexcept {
+  return this->_gpu_timing;
+}
+
+[[nodiscard]] std::uint32_t Profiler::begin_scope(const char* name, bool gpu) noexcept {
+  // last index is left out, so id is never no_scope.
+  if(!this->_enabled || this->_records.size() >= detail::profiler::scope_index_mask) {
+    return detail::profiler::no_scope;
+  }
+  ScopeRecord record { name, this->_depth++, now_ns(), 0, 0, 0 };
+  if(gpu && this->_gpu_timing) {
+    record.begin_query = this->_acquire_query();
+    glQueryCounter(record.begin_query, GL_TIMESTAMP);
+  }
+  this->_records.push_back(record);
+  return this->_scope_generation << detail::profiler::scope_index_bits |
+         static_cast<std::uint32_t>(this->_records.size() - 1);
+}
+
+void Profiler::end_scope(std::uint32_t scope) noexcept {
+  // frame might be closed (or profiler cleared) while scope was open; its
+  // record is gone then and depth was reset.
+  const auto index = scope & detail::profiler::scope_index_mask;
+  if(scope >> detail::profiler::scope_index_bits != this->_scope_generation ||
+     index >= this->_records.size() || this->_records[index].cpu_end_ns != 0) {
+    return;
+  }
+  auto& record = this->_records[index];
+  if(record.begin_query != 0) {
+    record.end_query = this->_acquire_query();
+    glQueryCounter(record.end_query, GL_TIMESTAMP);
+  }
+  record.cpu_end_ns = now_ns();
+  if(this->_depth > 0) {
+    --this->_depth;
+  }
+}
+
+[[nodiscard]] GLuint Profiler::_acquire_query() noexcept {
+  if(this->_free_queries.empty()) {
+    this->_free_queries.resize(query_batch);
+    glGenQueries(query_batch, this->_free_queries.data());
+  }
+  const GLuint query_id { this->_free_queries.back() };
+  this->_free_queries.pop_back();
+  return query_id;
+}
+
+[[nodiscard]] bool Profiler::_is_available(const PendingFrame& frame) const noexcept {
+  // timestamps complete in submission order; the last one is enough.
+  for(auto record = frame.records.rbegin(); record != frame.records.rend(); ++record) {
+    if(record->end_query != 0) {
+      GLint available { GL_FALSE };
+      glGetQueryObjectiv(record->end_query, GL_QUERY_RESULT_AVAILABLE, &available);
+      return available == GL_TRUE;
+    }
+  }
+  return true; // cpu-only frame.
+}
+
+void Profiler::_resolve(PendingFrame& frame) noexcept {
+  auto& result = this->_history[this->_history_head];
+  result.frame_index = frame.frame_index;
+  result.cpu_ms = frame.cpu_ms;
+  result.gpu_ms = 0.;
+  result.scopes.clear();
+  for(const auto& record: frame.records) {
+    double gpu_ms { 0. };
+    if(record.begin_query != 0) {
+      GLuint64 begin { 0 }, end { 0 };
+      glGetQueryObjectui64v(record.begin_query, GL_QUERY_RESULT, &begin);
+      glGetQueryObjectui64v(record.end_query, GL_QUERY_RESULT, &end);
+      gpu_ms = end > begin ? static_cast<double>(end - begin) / 1e6 : 0.;
+      this->_free_queries.push_back(record.begin_query);
+      this->_free_queries.push_back(record.end_query);
+    }
+    const double cpu_ms { static_cast<double>(record.cpu_end_ns - record.cpu_begin_ns) / 1e6 };
+    if(record.depth == 0) {
+      result.gpu_ms += gpu_ms;
+    }
+    // few distinct scopes per frame; linear search is fine.
+    const auto scope = std::find_if(result.scopes.begin(), result.scopes.end(), [&record](const auto& scope) {
+      return scope.depth == record.depth && (scope.name == record.name || std::strcmp(scope.name, record.name) == 0);
+    });
+    if(scope == result.scopes.end()) {
+      result.scopes.push_back(ProfileScopeResult { record.name, record.depth, 1, cpu_ms, gpu_ms });
+    } else {
+      ++scope->calls;
+      scope->cpu_ms += cpu_ms;
+      scope->gpu_ms += gpu_ms;
+    }
+  }
+  this->_history_head = (this->_history_head + 1) % this->_history.size();
+  this->_history_count = std::min(this->_history_count + 1, this->_history.size());
+}
+} // namespace fre2d
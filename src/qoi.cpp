@@ -0,0 +1,239 @@
+// MIT License
+//
+// Copyright (c) 2025 Ferhat Geçdoğan All Rights Reserved.
+// Distributed under the terms of the MIT License.
+//
+#include <qoi.hpp>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+namespace fre2d {
+namespace {
+[[nodiscard]] std::uint32_t read_u32_be(const std::uint8_t* data) noexcept {
+  return (static_cast<std::uint32_t>(data[0]) << 24) | (static_cast<std::uint32_t>(data[1]) << 16) |
+         (static_cast<std::uint32_t>(data[2]) << 8) | static_cast<std::uint32_t>(data[3]);
+}
+
+// channels is template parameter so pixel stores become fixed size moves
+// and run fills can be vectorized.
+template<std::size_t Channels>
+[[nodiscard]] bool decode_qoi_pixels(const std::uint8_t* data,
+                                     std::size_t size,
+                                     const QoiHeader& header,
+                                     std::uint8_t* destination,
+                                     bool flip_vertically) noexcept {
+  std::array<std::array<std::uint8_t, 4>, 64> index {};
+  std::array<std::uint8_t, 4> pixel { 0, 0, 0, 255 };
+  const auto* chunk = data + detail::qoi::header_size;
+  // ops are at most 5 bytes and end marker is 8, so checking chunk < end
+  // before each op never reads past data.
+  const auto* end = data + size - detail::qoi::end_marker.size();
+  std::uint32_t run { 0 };
+  const std::size_t row_size { static_cast<std::size_t>(header.width) * Channels };
+  for(std::uint32_t y = 0; y < header.height; ++y) {
+    auto* row = destination + (flip_vertically ? header.height - 1 - y : y) * row_size;
+    for(std::uint32_t x = 0; x < header.width; ++x) {
+      if(run > 0) {
+        // fill rest of run (within row) at once.
+        const auto count = std::min(run, header.width - x);
+        for(std::uint32_t i = 0; i < count; ++i) {
+          std::memcpy(row + static_cast<std::size_t>(x + i) * Channels, pixel.data(), Channels);
+        }
+        run -= count;
+        x += count - 1;
+        continue;
+      }
+      if(chunk >= end) {
+        std::cout << "fre2d error: decode_qoi(): truncated data.\n";
+        return false;
+      }
+      const auto op = *chunk++;
+      if(op == detail::qoi::op_rgb) {
+        std::memcpy(pixel.data(), chunk, 3);
+        chunk += 3;
+      } else if(op == detail::qoi::op_rgba) {
+        std::memcpy(pixel.data(), chunk, 4);
+        chunk += 4;
+      } else {
+        switch(op & detail::qoi::op_mask) {
+        case detail::qoi::op_index: { pixel = index[op]; break; }
+        case detail::qoi::op_diff: {
+          pixel[0] += ((op >> 4) & 0x03) - 2;
+          pixel[1] += ((op >> 2) & 0x03) - 2;
+          pixel[2] += (op & 0x03) - 2;
+          break;
+        }
+        case detail::qoi::op_luma: {
+          const auto next = *chunk++;
+          const int vg { (op & 0x3f) - 32 };
+          pixel[0] += vg - 8 + ((next >> 4) & 0x0f);
+          pixel[1] += vg;
+          pixel[2] += vg - 8 + (next & 0x0f);
+          break;
+        }
+        default: { run = op & 0x3f; break; } // op_run; this pixel + run more.
+        }
+      }
+      index[detail::qoi::hash(pixel[0], pixel[1], pixel[2], pixel[3])] = pixel;
+      std::memcpy(row + static_cast<std::size_t>(x) * Channels, pixel.data(), Channels);
+    }
+  }
+  return true;
+}
+} // anonymous namespace
+
+[[nodiscard]] std::vector<std::uint8_t> encode_qoi(
+  const std::uint8_t* pixels,
+  std::uint32_t width,
+  std::uint32_t height,
+  std::uint8_t channels,
+  bool flip_vertically,
+  QoiColorspace colorspace
+) noexcept {
+  if(!pixels || width == 0 || height == 0 || (channels != 3 && channels != 4) ||
+     height >= detail::qoi::max_pixels / width) {
+    std::cout << "fre2d error: encode_qoi(): invalid image " << width << "x" << height
+              << " with " << static_cast<int>(channels) << " channels.\n";
+    return {};
+  }
+
+  std::vector<std::uint8_t> bytes;
+  // worst case is op_rgba for every pixel.
+  bytes.reserve(detail::qoi::header_size +
+                static_cast<std::size_t>(width) * height * (channels + 1) +
+                detail::qoi::end_marker.size());
+  const auto push_u32 = [&bytes](std::uint32_t value) {
+    bytes.push_back(static_cast<std::uint8_t>(value >> 24));
+    bytes.push_back(static_cast<std::uint8_t>(value >> 16));
+    bytes.push_back(static_cast<std::uint8_t>(value >> 8));
+    bytes.push_back(static_cast<std::uint8_t>(value));
+  };
+  bytes.insert(bytes.end(), detail::qoi::magic.begin(), detail::qoi::magic.end());
+  push_u32(width);
+  push_u32(height);
+  bytes.push_back(channels);
+  bytes.push_back(colorspace);
+
+  std::array<std::array<std::uint8_t, 4>, 64> index {};
+  std::array<std::uint8_t, 4> previous { 0, 0, 0, 255 };
+  std::uint8_t run { 0 };
+  const std::size_t row_size { static_cast<std::size_t>(width) * channels };
+  for(std::uint32_t y = 0; y < height; ++y) {
+    const auto* row = pixels + (flip_vertically ? height - 1 - y : y) * row_size;
+    for(std::uint32_t x = 0; x < width; ++x) {
+      const auto* pixel = row + static_cast<std::size_t>(x) * channels;
+      const std::array<std::uint8_t, 4> current {
+        pixel[0], pixel[1], pixel[2], channels == 4 ? pixel[3] : std::uint8_t { 255 }
+      };
+      if(current == previous) {
+        if(++run == detail::qoi::max_run) {
+          bytes.push_back(detail::qoi::op_run | (run - 1));
+          run = 0;
+        }
+        continue;
+      }
+      if(run > 0) {
+        bytes.push_back(detail::qoi::op_run | (run - 1));
+        run = 0;
+      }
+
+      const auto hash = detail::qoi::hash(current[0], current[1], current[2], current[3]);
+      if(index[hash] == current) {
+        bytes.push_back(detail::qoi::op_index | static_cast<std::uint8_t>(hash));
+      } else {
+        index[hash] = current;
+        if(current[3] == previous[3]) {
+          // differences wrap around like unsigned bytes do.
+          const auto vr = static_cast<std::int8_t>(current[0] - previous[0]);
+          const auto vg = static_cast<std::int8_t>(current[1] - previous[1]);
+          const auto vb = static_cast<std::int8_t>(current[2] - previous[2]);
+          const auto vg_r = vr - vg;
+          const auto vg_b = vb - vg;
+          if(vr > -3 && vr < 2 && vg > -3 && vg < 2 && vb > -3 && vb < 2) {
+            bytes.push_back(detail::qoi::op_diff | (vr + 2) << 4 | (vg + 2) << 2 | (vb + 2));
+          } else if(vg_r > -9 && vg_r < 8 && vg > -33 && vg < 32 && vg_b > -9 && vg_b < 8) {
+            bytes.push_back(detail::qoi::op_luma | (vg + 32));
+            bytes.push_back(static_cast<std::uint8_t>((vg_r + 8) << 4 | (vg_b + 8)));
+          } else {
+            bytes.push_back(detail::qoi::op_rgb);
+            bytes.insert(bytes.end(), current.begin(), current.begin() + 3);
+          }
+        } else {
+          bytes.push_back(detail::qoi::op_rgba);
+          bytes.insert(bytes.end(), current.begin(), current.end());
+        }
+      }
+      previous = current;
+    }
+  }
+  if(run > 0) {
+    bytes.push_back(detail::qoi::op_run | (run - 1));
+  }
+  bytes.insert(bytes.end(), detail::qoi::end_marker.begin(), detail::qoi::end_marker.end());
+  return bytes;
+}
+
+[[nodiscard]] bool is_qoi(const std::uint8_t* data, std::size_t size) noexcept {
+  return data && size >= detail::qoi::magic.size() &&
+         std::equal(detail::qoi::magic.begin(), detail::qoi::magic.end(), data);
+}
+
+[[nodiscard]] bool read_qoi_header(const std::uint8_t* data, std::size_t size, QoiHeader& header) noexcept {
+  if(!is_qoi(data, size) || size < detail::qoi::header_size + detail::qoi::end_marker.size()) {
+    std::cout << "fre2d error: read_qoi_header(): not a qoi image.\n";
+    return false;
+  }
+  header.width = read_u32_be(data + 4);
+  header.height = read_u32_be(data + 8);
+  header.channels = data[12];
+  header.colorspace = static_cast<QoiColorspace>(data[13]);
+  if(header.width == 0 || header.height == 0 || (header.channels != 3 && header.channels != 4) ||
+     header.colorspace > QoiLinear || header.height >= detail::qoi::max_pixels / header.width) {
+    std::cout << "fre2d error: read_qoi_header(): invalid image " << header.width << "x" << header.height
+              << " with " << static_cast<int>(header.channels) << " channels.\n";
+    return false;
+  }
+  return true;
+}
+
+[[nodiscard]] bool decode_qoi(const std::uint8_t* data,
+                              std::size_t size,
+                              std::uint8_t* destination,
+                              std::uint8_t channels,
+                              bool flip_vertically) noexcept {
+  QoiHeader header;
+  if(!read_qoi_header(data, size, header)) {
+    return false;
+  }
+  if(!destination || (channels != 3 && channels != 4)) {
+    std::cout << "fre2d error: decode_qoi(): invalid destination.\n";
+    return false;
+  }
+  return channels == 4
+    ? decode_qoi_pixels<4>(data, size, header, destination, flip_vertically)
+    : decode_qoi_pixels<3>(data, size, header, destination, flip_vertically);
+}
+
+[[nodiscard]] bool read_qoi_file(const char* file_path, std::vector<std::uint8_t>& bytes) noexcept {
+  std::ifstream file(file_path, std::ios::binary);
+  std::array<char, 4> magic {};
+  if(!file || !file.read(magic.data(), magic.size()) ||
+     !std::equal(magic.begin(), magic.end(), detail::qoi::magic.begin())) {
+    return false;
+  }
+  // one read of known size; iterating stream char by char is slow on large sheets.
+  file.seekg(0, std::ios::end);
+  const auto size = static_cast<std::streamsize>(file.tellg());
+  if(size < 0 || !file.seekg(0)) {
+    return false;
+  }
+  bytes.resize(static_cast<std::size_t>(size));
+  if(!file.read(reinterpret_cast<char*>(bytes.data()), size)) {
+    bytes.clear();
+    return false;
+  }
+  return true;
+}
+} // namespace fre2d
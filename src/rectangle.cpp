@@ -5,6 +5,7 @@
 //
 #include <camera.hpp>
 #include <error.hpp>
+#include <profiler.hpp>
 #include <rectangle.hpp>
 #include <renderer.hpp>
 
@@ -56,6 +57,30 @@ Rectangle::Rectangle(
   );
 }
 
+Rectangle::Rectangle(
+  GLsizei width,
+  GLsizei height,
+  const glm::vec2& position,
+  const glm::vec4& color,
+  const TextureAtlas& atlas,
+  const AtlasRegion& region,
+  GLfloat rotation_rads,
+  bool flip_vertically,
+  bool flip_horizontally
+) noexcept {
+  this->initialize_rectangle(
+    width,
+    height,
+    position,
+    color,
+    atlas,
+    region,
+    rotation_rads,
+    flip_vertically,
+    flip_horizontally
+  );
+}
+
 // TODO: check for double initialization; especially Mesh class since we
 // generate new VAO instead of passing current one and set buffer attributes one
 // more time.
@@ -69,17 +94,15 @@ void Rectangle::initialize_rectangle(
   bool flip_vertically,
   bool flip_horizontally
 ) noexcept {
-  this->_vertices = {
-    Vertex(glm::vec2(-0.5f, -0.5f), color[0], glm::vec2(0.0f, 1.0f)),
-    Vertex(glm::vec2(0.5f, -0.5f), color[1], glm::vec2(1.0f, 0.0f)),
-    Vertex(glm::vec2(0.5f, 0.5f), color[2], glm::vec2(1.0f, 1.0f)),
-    Vertex(glm::vec2(-0.5f, 0.5f), color[3], glm::vec2(0.0f, 1.0f))
-  };
-
-  this->_mesh.initialize(this->_vertices, {0, 1, 2, 2, 3, 0}, texture);
-  this->initialize_drawable(
-    glm::vec3(width, height, 0.f),
+  this->_initialize_rectangle(
+    width,
+    height,
     position,
+    color,
+    texture,
+    glm::vec2(0.f, 0.f),
+    glm::vec2(1.f, 1.f),
+    detail::vertex::default_layer,
     rotation_rads,
     flip_vertically,
     flip_horizontally
@@ -96,12 +119,69 @@ void Rectangle::initialize_rectangle(
   GLfloat rotation_rads,
   bool flip_vertically,
   bool flip_horizontally
+) noexcept {
+  this->_initialize_rectangle(
+    width,
+    height,
+    position,
+    { color, color, color, color },
+    texture,
+    glm::vec2(0.f, 0.f),
+    glm::vec2(1.f, 1.f),
+    detail::vertex::default_layer,
+    rotation_rads,
+    flip_vertically,
+    flip_horizontally
+  );
+}
+
+void Rectangle::initialize_rectangle(
+  GLsizei width,
+  GLsizei height,
+  const glm::vec2 &position,
+  const glm::vec4 &color,
+  const TextureAtlas& atlas,
+  const AtlasRegion& region,
+  GLfloat rotation_rads,
+  bool flip_vertically,
+  bool flip_horizontally
+) noexcept {
+  // rectangles sharing a page share texture name too; so switching between
+  // them needs no new texture bind.
+  this->_initialize_rectangle(
+    width,
+    height,
+    position,
+    { color, color, color, color },
+    atlas.get_page(region.page),
+    region.uv_min,
+    region.uv_max,
+    atlas.is_array() ? static_cast<GLfloat>(region.page) : detail::vertex::default_layer,
+    rotation_rads,
+    flip_vertically,
+    flip_horizontally
+  );
+}
+
+void Rectangle::_initialize_rectangle(
+  GLsizei width,
+  GLsizei height,
+  const glm::vec2 &position,
+  const std::array<glm::vec4, 4> &color,
+  const Texture& texture,
+  const glm::vec2& uv_min,
+  const glm::vec2& uv_max,
+  GLfloat layer,
+  GLfloat rotation_rads,
+  bool flip_vertically,
+  bool flip_horizontally
 ) noexcept {
   this->_vertices = {
-    Vertex(glm::vec2(-0.5f, -0.5f), color, glm::vec2(0.0f, 0.0f)),
-    Vertex(glm::vec2(0.5f, -0.5f), color, glm::vec2(1.0f, 0.0f)),
-    Vertex(glm::vec2(0.5f, 0.5f), color, glm::vec2(1.0f, 1.0f)),
-    Vertex(glm::vec2(-0.5f, 0.5f), color, glm::vec2(0.0f, 1.0f))};
+    Vertex(glm::vec2(-0.5f, -0.5f), color[0], glm::vec2(uv_min.x, uv_min.y), layer),
+    Vertex(glm::vec2(0.5f, -0.5f), color[1], glm::vec2(uv_max.x, uv_min.y), layer),
+    Vertex(glm::vec2(0.5f, 0.5f), color[2], glm::vec2(uv_max.x, uv_max.y), layer),
+    Vertex(glm::vec2(-0.5f, 0.5f), color[3], glm::vec2(uv_min.x, uv_max.y), layer)
+  };
 
   this->_mesh.initialize(this->_vertices, {0, 1, 2, 2, 3, 0}, texture);
   this->initialize_drawable(
@@ -119,6 +199,11 @@ void Rectangle::draw(const Shader& shader, const std::unique_ptr<Renderer>& rnd)
 
 void Rectangle::draw(const Shader &shader, const std::unique_ptr<Camera> &cam,
                      const std::unique_ptr<LightManager> &lm) noexcept {
+  // deferred shader is still compiling; skip this draw instead of stalling.
+  if(!shader.is_ready()) {
+    return;
+  }
+  ProfileScope scope("Rectangle::draw");
   this->before_draw(shader, cam, lm);
   shader.use();
   this->_mesh.get_vao().bind();
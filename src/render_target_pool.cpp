@@ -0,0 +1,112 @@
+// MIT License
+//
+// Copyright (c) 2025 Ferhat Geçdoğan All Rights Reserved.
+// Distributed under the terms of the MIT License.
+//
+#include <render_target_pool.hpp>
+#include <algorithm>
+#include <iostream>
+
+namespace fre2d {
+RenderTargetPool::RenderTargetPool(std::uint32_t max_unused_frames) noexcept
+  : _frame_index{0}, _max_unused_frames{max_unused_frames} {}
+
+[[nodiscard]] Framebuffer& RenderTargetPool::acquire(GLsizei width, GLsizei height, const RenderTargetDesc& desc) noexcept {
+  // exact size first; then anything that fits without reallocating.
+  // resize() with ResizeGrow only changes viewport as long as target is not
+  // smaller than requested size and not more than twice as big.
+  Entry* candidate { nullptr };
+  for(auto& entry: this->_entries) {
+    if(entry.in_use || entry.framebuffer->get_render_target_desc() != desc) {
+      continue;
+    }
+    const auto& fb = entry.framebuffer;
+    if(fb->get_width() == width && fb->get_height() == height) {
+      candidate = &entry;
+      break;
+    }
+    if(!candidate &&
+       fb->get_capacity_width() >= width && fb->get_capacity_height() >= height &&
+       (width * 2 >= fb->get_capacity_width() || height * 2 >= fb->get_capacity_height())) {
+      candidate = &entry;
+    }
+  }
+
+  if(!candidate) {
+    if(this->_shader.get_program_id() == 0) {
+      this->_shader.initialize(detail::framebuffer::default_vertex, detail::framebuffer::default_fragment);
+    }
+    auto fb = std::make_unique<Framebuffer>();
+    // pool program is compiled from default shaders, so plain presents can be blitted.
+    fb->set_framebuffer_shader(this->_shader, true);
+    // pooled targets are reused for nearby sizes; see condition above.
+    fb->set_resize_policy(ResizeGrow);
+    fb->initialize(width, height, desc);
+    if(!fb->is_complete()) {
+      std::cout << "fre2d error: RenderTargetPool::acquire(): framebuffer is not complete\n";
+    }
+    this->_entries.push_back(Entry{std::move(fb), this->_frame_index, false});
+    candidate = &this->_entries.back();
+  }
+
+  candidate->framebuffer->resize(width, height);
+  candidate->in_use = true;
+  candidate->last_used_frame = this->_frame_index;
+  return *candidate->framebuffer;
+}
+
+void RenderTargetPool::release(const Framebuffer& fb) noexcept {
+  for(auto& entry: this->_entries) {
+    if(entry.framebuffer.get() == &fb) {
+      entry.in_use = false;
+      entry.last_used_frame = this->_frame_index;
+      return;
+    }
+  }
+  std::cout << "fre2d warning: RenderTargetPool::release(): framebuffer "
+            << fb.get_fbo_id() << " does not belong to this pool.\n";
+}
+
+void RenderTargetPool::end_frame() noexcept {
+  ++this->_frame_index;
+  std::erase_if(this->_entries, [this](const Entry& entry) {
+    return !entry.in_use && this->_frame_index - entry.last_used_frame > this->_max_unused_frames;
+  });
+}
+
+void RenderTargetPool::clear() noexcept {
+  std::erase_if(this->_entries, [](const Entry& entry) {
+    return !entry.in_use;
+  });
+}
+
+void RenderTargetPool::set_max_unused_frames(std::uint32_t max_unused_frames) noexcept {
+  this->_max_unused_frames = max_unused_frames;
+}
+
+[[nodiscard]] const std::uint32_t& RenderTargetPool::get_max_unused_frames() const noexcept {
+  return this->_max_unused_frames;
+}
+
+[[nodiscard]] const std::uint64_t& RenderTargetPool::get_frame_index() const noexcept {
+  return this->_frame_index;
+}
+
+[[nodiscard]] std::size_t RenderTargetPool::get_target_count() const noexcept {
+  return this->_entries.size();
+}
+
+[[nodiscard]] std::size_t RenderTargetPool::get_in_use_count() const noexcept {
+  return static_cast<std::size_t>(std::count_if(this->_entries.begin(), this->_entries.end(), [](const Entry& entry) {
+    return entry.in_use;
+  }));
+}
+
+[[nodiscard]] std::size_t RenderTargetPool::get_memory_usage() const noexcept {
+  std::size_t bytes { 0 };
+  for(const auto& entry: this->_entries) {
+    bytes += entry.framebuffer->get_memory_usage();
+  }
+  return bytes;
+}
+} // namespace fre2d
@@ -5,30 +5,68 @@
 //
 #include "framebuffer.hpp"
 #include <renderbuffer.hpp>
+#include <gpu_memory_tracker.hpp>
+#include <algorithm>
 
 namespace fre2d {
 // i don't know why but clang-tidy gives me "constructor does not initialize these fields: ...".
 // we actually initialize them. it might be false positive.
 // (i use clang-tidy that comes with CLion, so it might be fixed in later versions)
-Renderbuffer::Renderbuffer(GLsizei width, GLsizei height, GLuint internal_format, GLuint attachment) noexcept {
-  this->initialize(width, height, internal_format, attachment);
+Renderbuffer::Renderbuffer() noexcept
+  : _rbo_id{0},
+    _width{0},
+    _height{0},
+    _internal_format{detail::renderbuffer::default_internal_format},
+    _attachment{detail::renderbuffer::default_attachment},
+    _samples{detail::renderbuffer::default_samples} {}
+
+Renderbuffer::Renderbuffer(GLsizei width, GLsizei height, GLuint internal_format, GLuint attachment, GLsizei samples) noexcept {
+  this->initialize(width, height, internal_format, attachment, samples);
 }
 
 Renderbuffer::~Renderbuffer() noexcept {
   if(this->get_rbo_id() != 0) {
+    GpuMemoryTracker::get().untrack(GpuMemoryClassRenderbuffer, this->_rbo_id);
     glDeleteRenderbuffers(1, &this->_rbo_id);
   }
 }
 
-void Renderbuffer::initialize(GLsizei width, GLsizei height, GLuint internal_format, GLuint attachment) noexcept {
+void Renderbuffer::initialize(GLsizei width, GLsizei height, GLuint internal_format, GLuint attachment, GLsizei samples) noexcept {
   this->_width = width;
   this->_height = height;
   this->_internal_format = internal_format;
   this->_attachment = attachment;
+  this->_samples = samples;
   glGenRenderbuffers(1, &this->_rbo_id);
+  // generated name becomes an object on first bind, DSA calls need that.
   this->bind();
-  glRenderbufferStorage(GL_RENDERBUFFER, this->_internal_format, width, height);
   this->unbind();
+  this->_allocate_storage();
+}
+
+void Renderbuffer::resize(GLsizei width, GLsizei height) noexcept {
+  if(this->get_rbo_id() == 0) {
+    // keeps format, attachment and samples given before (defaults otherwise).
+    this->initialize(width, height, this->_internal_format, this->_attachment, this->_samples);
+    return;
+  }
+  this->_width = width;
+  this->_height = height;
+  this->_allocate_storage();
+}
+
+void Renderbuffer::_allocate_storage() const noexcept {
+  if(this->_samples > 1) {
+    glNamedRenderbufferStorageMultisample(this->get_rbo_id(), this->_samples, this->_internal_format, this->_width, this->_height);
+  } else {
+    glNamedRenderbufferStorage(this->get_rbo_id(), this->_internal_format, this->_width, this->_height);
+  }
+  GpuMemoryTracker::get().track(
+    GpuMemoryClassRenderbuffer,
+    this->get_rbo_id(),
+    get_mip_chain_bytes(this->_width, this->_height, get_internal_format_bytes(this->_internal_format)) *
+      static_cast<std::size_t>(std::max(this->_samples, 1))
+  );
 }
 
 void Renderbuffer::bind() const noexcept {
@@ -47,4 +85,8 @@ void Renderbuffer::attach(const Framebuffer& fb, GLuint attachment) const noexce
 [[nodiscard]] const GLuint& Renderbuffer::get_rbo_id() const noexcept {
   return this->_rbo_id;
 }
+
+[[nodiscard]] const GLsizei& Renderbuffer::get_samples() const noexcept {
+  return this->_samples;
+}
 } // namespace fre2d
\ No newline at end of file
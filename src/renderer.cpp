@@ -73,4 +73,22 @@ void Renderer::resize(GLsizei width, GLsizei height) noexcept {
 [[nodiscard]] const std::unique_ptr<LightManager>& Renderer::get_light_manager() const noexcept {
   return this->_lm;
 }
+
+void Renderer::set_blend_mode(BlendMode blend_mode) noexcept {
+  Renderer::_blend_mode = blend_mode;
+  if(blend_mode == BlendModeNone) {
+    glDisable(GL_BLEND);
+    return;
+  }
+  glEnable(GL_BLEND);
+  switch(blend_mode) {
+  case BlendModePremultiplied: { glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA); break; }
+  case BlendModeAdditive: { glBlendFunc(GL_SRC_ALPHA, GL_ONE); break; }
+  default: { glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); break; }
+  }
+}
+
+[[nodiscard]] const BlendMode& Renderer::get_blend_mode() noexcept {
+  return Renderer::_blend_mode;
+}
 } // namespace fre2d
\ No newline at end of file
@@ -0,0 +1,211 @@
+// MIT License
+//
+// Copyright (c) 2025 Ferhat Geçdoğan All Rights Reserved.
+// Distributed under the terms of the MIT License.
+//
+#include <resource_registry.hpp>
+#include <gpu_memory_tracker.hpp>
+#include <iostream>
+
+namespace fre2d {
+[[nodiscard]] ResourceRegistry& ResourceRegistry::get() noexcept {
+  thread_local ResourceRegistry registry;
+  return registry;
+}
+
+void ResourceRegistry::set_shader_stages(ShaderHandle handle, GLuint vertex_id, GLuint fragment_id) noexcept {
+  if(auto* slot = this->_find(ResourceTypeShader, handle.value)) {
+    slot->vertex_id = vertex_id;
+    slot->fragment_id = fragment_id;
+  }
+}
+
+[[nodiscard]] std::pair<GLuint, GLuint> ResourceRegistry::get_shader_stages(ShaderHandle handle) const noexcept {
+  const auto* slot = this->_find(ResourceTypeShader, handle.value);
+  return slot ? std::pair { slot->vertex_id, slot->fragment_id } : std::pair<GLuint, GLuint> { 0, 0 };
+}
+
+void ResourceRegistry::set_texture_sampler(TextureHandle handle, GLuint sampler_id) noexcept {
+  if(auto* slot = this->_find(ResourceTypeTexture, handle.value)) {
+    slot->sampler_id = sampler_id;
+  }
+}
+
+[[nodiscard]] GLuint ResourceRegistry::get_texture_sampler(TextureHandle handle) const noexcept {
+  const auto* slot = this->_find(ResourceTypeTexture, handle.value);
+  return slot ? slot->sampler_id : 0;
+}
+
+void ResourceRegistry::end_frame() noexcept {
+  this->_deferred = true;
+  // evictions are deleted with the rest below.
+  GpuMemoryTracker::get()._end_frame();
+  for(std::size_t type = 0; type < ResourceTypeCount; ++type) {
+    this->_flush(static_cast<ResourceType>(type));
+  }
+}
+
+void ResourceRegistry::clear() noexcept {
+  for(std::size_t type = 0; type < ResourceTypeCount; ++type) {
+    auto& pool = this->_pools[type];
+    for(std::uint32_t index = 0; index < pool.slots.size(); ++index) {
+      // _destroy() skips slots that are not live.
+      const auto& slot = pool.slots[index];
+      this->_destroy(
+        static_cast<ResourceType>(type),
+        slot.generation << detail::resource_registry::index_bits | index,
+        true
+      );
+    }
+    this->_flush(static_cast<ResourceType>(type));
+  }
+}
+
+[[nodiscard]] std::size_t ResourceRegistry::get_live_count(ResourceType type) const noexcept {
+  return this->_pools[type].live_count;
+}
+
+[[nodiscard]] std::size_t ResourceRegistry::get_pending_count(ResourceType type) const noexcept {
+  return this->_pools[type].destroyed_names.size();
+}
+
+[[nodiscard]] const bool& ResourceRegistry::is_deferred() const noexcept {
+  return this->_deferred;
+}
+
+[[nodiscard]] std::uint32_t ResourceRegistry::_create(ResourceType type, GLuint name) noexcept {
+  auto& pool = this->_pools[type];
+  std::uint32_t index;
+  if(!pool.free_indices.empty()) {
+    index = pool.free_indices.back();
+    pool.free_indices.pop_back();
+  } else {
+    if(pool.slots.size() > detail::resource_registry::index_mask) {
+      std::cout << "fre2d error: ResourceRegistry::create(): no free slots left.\n";
+      if(name != 0) {
+        pool.destroyed_names.push_back(name);
+        this->_flush_if_immediate(type);
+      }
+      return 0;
+    }
+    index = static_cast<std::uint32_t>(pool.slots.size());
+    pool.slots.push_back(Slot { 0, 0, 0, 0, 0, 1, false });
+  }
+  auto& slot = pool.slots[index];
+  slot.name = name;
+  slot.vertex_id = slot.fragment_id = slot.sampler_id = 0;
+  slot.ref_count = 1;
+  slot.live = true;
+  ++pool.live_count;
+  return slot.generation << detail::resource_registry::index_bits | index;
+}
+
+GLuint ResourceRegistry::_destroy(ResourceType type, std::uint32_t value, bool delete_name) noexcept {
+  auto* slot = this->_find(type, value);
+  if(!slot) {
+    return 0;
+  }
+  auto& pool = this->_pools[type];
+  const GLuint name { slot->name };
+  if(delete_name && name != 0) {
+    pool.destroyed_names.push_back(name);
+  }
+  // stages are never handed out; they go either way.
+  for(const GLuint stage_id: { slot->vertex_id, slot->fragment_id }) {
+    if(stage_id != 0) {
+      pool.destroyed_stages.push_back(stage_id);
+    }
+  }
+  slot->name = slot->vertex_id = slot->fragment_id = slot->sampler_id = 0;
+  slot->ref_count = 0;
+  slot->live = false;
+  // generation 0 is skipped; handle value 0 is null.
+  slot->generation = slot->generation == detail::resource_registry::max_generation ? 1 : slot->generation + 1;
+  pool.destroyed_indices.push_back(value & detail::resource_registry::index_mask);
+  --pool.live_count;
+  // its bytes are gone at once; GpuMemoryTracker would drop it only in end_frame().
+  auto& tracker = GpuMemoryTracker::get();
+  if(type == ResourceTypeTexture) {
+    tracker.untrack(GpuMemoryClassTexture, value);
+  } else if(type == ResourceTypeBuffer) {
+    for(const auto memory_class: { GpuMemoryClassVertexBuffer, GpuMemoryClassElementBuffer, GpuMemoryClassStorageBuffer }) {
+      tracker.untrack(memory_class, value);
+    }
+  }
+  this->_flush_if_immediate(type);
+  return name;
+}
+
+void ResourceRegistry::_set_name(ResourceType type, std::uint32_t value, GLuint name) noexcept {
+  auto& pool = this->_pools[type];
+  auto* slot = this->_find(type, value);
+  const GLuint previous_name { slot ? slot->name : name };
+  if(previous_name != 0 && (!slot || previous_name != name)) {
+    pool.destroyed_names.push_back(previous_name);
+  }
+  if(slot) {
+    slot->name = name;
+  }
+  this->_flush_if_immediate(type);
+}
+
+[[nodiscard]] ResourceRegistry::Slot* ResourceRegistry::_find(ResourceType type, std::uint32_t value) noexcept {
+  return const_cast<Slot*>(static_cast<const ResourceRegistry*>(this)->_find(type, value));
+}
+
+[[nodiscard]] const ResourceRegistry::Slot* ResourceRegistry::_find(ResourceType type, std::uint32_t value) const noexcept {
+  const auto& slots = this->_pools[type].slots;
+  const auto index = value & detail::resource_registry::index_mask;
+  if(value == 0 || index >= slots.size() || !slots[index].live ||
+     slots[index].generation != value >> detail::resource_registry::index_bits) {
+    return nullptr;
+  }
+  return &slots[index];
+}
+
+void ResourceRegistry::_flush(ResourceType type) noexcept {
+  auto& pool = this->_pools[type];
+  ResourceRegistry::_delete_pending(type, pool);
+  pool.free_indices.insert(pool.free_indices.end(), pool.destroyed_indices.begin(), pool.destroyed_indices.end());
+  pool.destroyed_indices.clear();
+}
+
+void ResourceRegistry::_flush_if_immediate(ResourceType type) noexcept {
+  if(!this->_deferred) {
+    this->_flush(type);
+  }
+}
+
+void ResourceRegistry::_delete_pending(ResourceType type, Pool& pool) noexcept {
+  const auto count = static_cast<GLsizei>(pool.destroyed_names.size());
+  switch(type) {
+  case ResourceTypeTexture: {
+    if(count > 0) {
+      glDeleteTextures(count, pool.destroyed_names.data());
+    }
+    break;
+  }
+  case ResourceTypeShader: {
+    // no batched variant for programs.
+    for(const GLuint program_id: pool.destroyed_names) {
+      glDeleteProgram(program_id);
+    }
+    for(const GLuint stage_id: pool.destroyed_stages) {
+      glDeleteShader(stage_id);
+    }
+    break;
+  }
+  case ResourceTypeBuffer: {
+    if(count > 0) {
+      glDeleteBuffers(count, pool.destroyed_names.data());
+    }
+    break;
+  }
+  default: {
+    break;
+  }
+  }
+  pool.destroyed_names.clear();
+  pool.destroyed_stages.clear();
+}
+} // namespace fre2d
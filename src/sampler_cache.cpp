@@ -0,0 +1,75 @@
+// MIT License
+//
+// Copyright (c) 2025 Ferhat Geçdoğan All Rights Reserved.
+// Distributed under the terms of the MIT License.
+//
+#include <sampler_cache.hpp>
+#include <algorithm>
+#include <cstring>
+
+namespace fre2d {
+[[nodiscard]] SamplerCache& SamplerCache::get() noexcept {
+  thread_local SamplerCache cache;
+  return cache;
+}
+
+[[nodiscard]] GLuint SamplerCache::get_sampler(const SamplerDesc& desc) noexcept {
+  for(const auto& [cached_desc, sampler_id]: this->_samplers) {
+    if(cached_desc == desc) {
+      return sampler_id;
+    }
+  }
+  GLuint sampler_id { 0 };
+  glCreateSamplers(1, &sampler_id);
+  glSamplerParameteri(sampler_id, GL_TEXTURE_MIN_FILTER, static_cast<GLint>(desc.min_filter));
+  glSamplerParameteri(sampler_id, GL_TEXTURE_MAG_FILTER, static_cast<GLint>(desc.mag_filter));
+  glSamplerParameteri(sampler_id, GL_TEXTURE_WRAP_S, static_cast<GLint>(desc.wrap_s));
+  glSamplerParameteri(sampler_id, GL_TEXTURE_WRAP_T, static_cast<GLint>(desc.wrap_t));
+  if(desc.anisotropy > 1.f && SamplerCache::get_max_anisotropy() > 1.f) {
+    glSamplerParameterf(
+      sampler_id,
+      detail::sampler_cache::texture_max_anisotropy,
+      std::min(desc.anisotropy, SamplerCache::get_max_anisotropy())
+    );
+  }
+  this->_samplers.emplace_back(desc, sampler_id);
+  return sampler_id;
+}
+
+void SamplerCache::bind(GLuint texture_unit, const SamplerDesc& desc) noexcept {
+  glBindSampler(texture_unit, this->get_sampler(desc));
+}
+
+void SamplerCache::clear() noexcept {
+  for(auto& [desc, sampler_id]: this->_samplers) {
+    glDeleteSamplers(1, &sampler_id);
+  }
+  this->_samplers.clear();
+}
+
+[[nodiscard]] std::size_t SamplerCache::get_sampler_count() const noexcept {
+  return this->_samplers.size();
+}
+
+[[nodiscard]] GLfloat SamplerCache::get_max_anisotropy() noexcept {
+  static const GLfloat max_anisotropy = [] {
+    GLint major { 0 }, minor { 0 };
+    glGetIntegerv(GL_MAJOR_VERSION, &major);
+    glGetIntegerv(GL_MINOR_VERSION, &minor);
+    bool supported { major > 4 || (major == 4 && minor >= 6) };
+    GLint count { 0 };
+    glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+    for(GLint i = 0; i < count && !supported; ++i) {
+      const auto* name = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, i));
+      supported = name && (std::strcmp(name, "GL_ARB_texture_filter_anisotropic") == 0 ||
+                           std::strcmp(name, "GL_EXT_texture_filter_anisotropic") == 0);
+    }
+    GLfloat value { 1.f };
+    if(supported) {
+      glGetFloatv(detail::sampler_cache::max_texture_max_anisotropy, &value);
+    }
+    return std::max(value, 1.f);
+  }();
+  return max_anisotropy;
+}
+} // namespace fre2d
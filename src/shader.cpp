@@ -6,35 +6,129 @@
 #include <shader.hpp>
 #include <glm/gtc/type_ptr.hpp>
 #include <iostream>
+#include <cstring>
+#include <utility>
 
 #define UNIFORM_LOC() this->get_uniform_location(uniform_name)
 
 namespace fre2d {
-Shader::Shader() noexcept {
-  this->_program_id = std::make_shared<GLuint>(0);
-}
+Shader::Shader() noexcept {}
 
-Shader::Shader(const char* vertex_shader, const char* fragment_shader) noexcept {
-  this->_program_id = std::make_shared<GLuint>(0);
-  this->initialize(vertex_shader, fragment_shader);
+Shader::Shader(const char* vertex_shader, const char* fragment_shader, bool deferred) noexcept {
+  this->initialize(vertex_shader, fragment_shader, deferred);
 }
 
 Shader::Shader(GLuint program_id) noexcept
-  : _program_id{std::make_shared<GLuint>(program_id)} {
+  : _handle{program_id != 0 ? ResourceRegistry::get().create<ResourceTypeShader>(program_id) : ShaderHandle{}} {
+}
+
+Shader::Shader(const Shader& shader) noexcept
+  : _handle{shader._handle} {
+  ResourceRegistry::get().add_ref(this->_handle);
+}
+
+Shader::Shader(Shader&& shader) noexcept
+  : _handle{std::exchange(shader._handle, ShaderHandle{})} {}
+
+Shader& Shader::operator=(const Shader& shader) noexcept {
+  if(this != &shader) {
+    auto& registry = ResourceRegistry::get();
+    registry.add_ref(shader._handle);
+    registry.remove_ref(this->_handle);
+    this->_handle = shader._handle;
+  }
+  return *this;
+}
+
+Shader& Shader::operator=(Shader&& shader) noexcept {
+  if(this != &shader) {
+    ResourceRegistry::get().remove_ref(this->_handle);
+    this->_handle = std::exchange(shader._handle, ShaderHandle{});
+  }
+  return *this;
 }
 
 Shader::~Shader() noexcept {
-  this->release();
+  if(!this->_handle.is_null()) {
+    ResourceRegistry::get().remove_ref(this->_handle);
+  }
 }
 
-void Shader::initialize(const char* vertex_shader, const char* fragment_shader) noexcept {
+void Shader::initialize(const char* vertex_shader, const char* fragment_shader, bool deferred) noexcept {
+  // we submit both stages and link without querying any status in between;
+  // every glGet* here would force driver to finish compilation first.
+  GLuint vertex_id = glCreateShader(GL_VERTEX_SHADER);
+  glShaderSource(vertex_id, 1, &vertex_shader, NULL);
+  glCompileShader(vertex_id);
+
+  GLuint fragment_id = glCreateShader(GL_FRAGMENT_SHADER);
+  glShaderSource(fragment_id, 1, &fragment_shader, NULL);
+  glCompileShader(fragment_id);
+
+  const GLuint program_id = glCreateProgram();
+  glAttachShader(program_id, vertex_id);
+  glAttachShader(program_id, fragment_id);
+  glLinkProgram(program_id);
+
+  // reinitializing replaces program for every copy; old one is deleted by ResourceRegistry.
+  auto& registry = ResourceRegistry::get();
+  const auto [old_vertex_id, old_fragment_id] = registry.get_shader_stages(this->_handle);
+  if(old_vertex_id != 0) {
+    glDeleteShader(old_vertex_id);
+    glDeleteShader(old_fragment_id);
+  }
+  registry.assign(this->_handle, program_id);
+  registry.set_shader_stages(this->_handle, vertex_id, fragment_id);
+  if(!deferred) {
+    this->_finalize();
+  }
+}
+
+[[nodiscard]] bool Shader::is_ready() const noexcept {
+  if(ResourceRegistry::get().get_shader_stages(this->_handle).first == 0) {
+    return true;
+  }
+  // without extension, there's no way to ask without blocking;
+  // so we just finalize it on first check.
+  if(Shader::is_parallel_compile_supported()) {
+    GLint completed { GL_FALSE };
+    glGetProgramiv(this->get_program_id(), detail::shader::completion_status_khr, &completed);
+    if(completed == GL_FALSE) {
+      return false;
+    }
+  }
+  this->_finalize();
+  return true;
+}
+
+[[nodiscard]] bool Shader::is_parallel_compile_supported() noexcept {
+  static const bool supported = [] {
+    GLint count { 0 };
+    glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+    for(GLint i = 0; i < count; ++i) {
+      const auto* name = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, i));
+      if(name && (std::strcmp(name, "GL_KHR_parallel_shader_compile") == 0 ||
+                  std::strcmp(name, "GL_ARB_parallel_shader_compile") == 0)) {
+        return true;
+      }
+    }
+    return false;
+  }();
+  return supported;
+}
+
+// checks compile & link status, logs errors and deletes stage objects.
+void Shader::_finalize() const noexcept {
+  // stages are in registry; so other copies see that it's already finalized.
+  auto& registry = ResourceRegistry::get();
+  const auto [vertex_id, fragment_id] = registry.get_shader_stages(this->_handle);
+  if(vertex_id == 0) {
+    return;
+  }
   // probably enough for most cases
   char error_log[detail::shader::info_log_size];
   GLint success;
 
-  GLuint vertex_id = glCreateShader(GL_VERTEX_SHADER);
-  glShaderSource(vertex_id, 1, &vertex_shader, NULL);
-  glCompileShader(vertex_id);
   glGetShaderiv(vertex_id, GL_COMPILE_STATUS, &success);
   if (!success) {
     glGetShaderInfoLog(vertex_id, detail::shader::info_log_size, NULL,
@@ -44,9 +138,6 @@ void Shader::initialize(const char* vertex_shader, const char* fragment_shader)
     // TODO: vertex shader compilation failed; use custom log, use colorized.
   }
 
-  GLuint fragment_id = glCreateShader(GL_FRAGMENT_SHADER);
-  glShaderSource(fragment_id, 1, &fragment_shader, NULL);
-  glCompileShader(fragment_id);
   glGetShaderiv(fragment_id, GL_COMPILE_STATUS, &success);
   if (!success) {
     glGetShaderInfoLog(fragment_id, detail::shader::info_log_size, NULL,
@@ -56,10 +147,6 @@ void Shader::initialize(const char* vertex_shader, const char* fragment_shader)
     // TODO: fragment shader compilation failed; use custom log, use colorized.
   }
 
-  *this->_program_id = glCreateProgram();
-  glAttachShader(this->get_program_id(), vertex_id);
-  glAttachShader(this->get_program_id(), fragment_id);
-  glLinkProgram(this->get_program_id());
   glGetProgramiv(this->get_program_id(), GL_LINK_STATUS, &success);
   if (!success) {
     glGetProgramInfoLog(this->get_program_id(), detail::shader::info_log_size,
@@ -71,10 +158,15 @@ void Shader::initialize(const char* vertex_shader, const char* fragment_shader)
 
   glDeleteShader(vertex_id);
   glDeleteShader(fragment_id);
+  registry.set_shader_stages(this->_handle, 0, 0);
 }
 
-[[nodiscard]] const GLuint& Shader::get_program_id() const noexcept {
-  return *this->_program_id;
+[[nodiscard]] GLuint Shader::get_program_id() const noexcept {
+  return ResourceRegistry::get().get_name(this->_handle);
+}
+
+[[nodiscard]] const ShaderHandle& Shader::get_handle() const noexcept {
+  return this->_handle;
 }
 
 [[nodiscard]] GLuint Shader::get_uniform_location(const char* uniform_name) const noexcept {
@@ -82,24 +174,28 @@ void Shader::initialize(const char* vertex_shader, const char* fragment_shader)
 }
 
 void Shader::use() const noexcept {
-  glUseProgram(*this->_program_id);
+  glUseProgram(this->get_program_id());
 }
 
 void Shader::load(GLuint program_id) noexcept {
   this->release();
-  this->_program_id = std::make_shared<GLuint>(program_id);
+  if(program_id != 0) {
+    this->_handle = ResourceRegistry::get().create<ResourceTypeShader>(program_id);
+  }
 }
 
+// registry forgets current program without deleting it; manage it yourself.
 void Shader::load_override(GLuint program_id) noexcept {
-  this->_program_id = std::make_shared<GLuint>(program_id);
+  ResourceRegistry::get().detach(this->_handle);
+  this->_handle = program_id != 0 ? ResourceRegistry::get().create<ResourceTypeShader>(program_id) : ShaderHandle{};
 }
 
+// deletes program (and stage objects of deferred program that never
+// checked by is_ready()) through ResourceRegistry, for every copy; last copy going
+// out of scope does the same.
 void Shader::release() noexcept {
-  // delete program when shader goes out of scope.
-  if(this->get_program_id() != 0 && this->_program_id.use_count() == 1) {
-    glDeleteProgram(*this->_program_id);
-    *this->_program_id = 0;
-  }
+  ResourceRegistry::get().destroy(this->_handle);
+  this->_handle = {};
 }
 
 void Shader::set_bool(const char* uniform_name, GLboolean value) const noexcept {
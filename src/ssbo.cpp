@@ -4,9 +4,10 @@
 // Distributed under the terms of the MIT License.
 //
 #include <ssbo.hpp>
+#include <gpu_memory_tracker.hpp>
 
 namespace fre2d {
-SSBO::SSBO() noexcept : _ssbo_id{0}, _binding_id{0}
+SSBO::SSBO() noexcept : _binding_id{0}
 {}
 
 template <typename T>
@@ -15,9 +16,8 @@ SSBO::SSBO(GLint binding, const std::vector<T> &buffer) noexcept {
 }
 
 SSBO::~SSBO() noexcept {
-  if(this->get_ssbo_id() != 0) {
-    glDeleteBuffers(1, &this->_ssbo_id);
-  }
+  // deleted by ResourceRegistry (at once or in end_frame()).
+  ResourceRegistry::get().destroy(this->_handle);
 }
 
 void SSBO::bind() const noexcept {
@@ -28,14 +28,21 @@ void SSBO::unbind() const noexcept {
   glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
 }
 
-[[nodiscard]] const GLuint &SSBO::get_ssbo_id() const noexcept {
-  return this->_ssbo_id;
+[[nodiscard]] GLuint SSBO::get_ssbo_id() const noexcept {
+  return ResourceRegistry::get().get_name(this->_handle);
+}
+
+[[nodiscard]] const BufferHandle& SSBO::get_handle() const noexcept {
+  return this->_handle;
 }
 
 void SSBO::empty_initialize(GLint binding) noexcept {
-  glGenBuffers(1, &this->_ssbo_id);
+  GLuint ssbo_id { 0 };
+  glGenBuffers(1, &ssbo_id);
+  ResourceRegistry::get().assign(this->_handle, ssbo_id);
   this->bind();
   glBufferData(GL_SHADER_STORAGE_BUFFER, 0, NULL, GL_DYNAMIC_DRAW);
+  GpuMemoryTracker::get().track(GpuMemoryClassStorageBuffer, this->_handle.value, 0);
   glBindBufferBase(GL_SHADER_STORAGE_BUFFER, binding, this->get_ssbo_id());
   this->_binding_id = binding;
   this->unbind();
@@ -43,9 +50,12 @@ void SSBO::empty_initialize(GLint binding) noexcept {
 
 template <typename T>
 void SSBO::initialize(GLint binding, const std::vector<T>& buffer) noexcept {
-  glGenBuffers(1, &this->_ssbo_id);
+  GLuint ssbo_id { 0 };
+  glGenBuffers(1, &ssbo_id);
+  ResourceRegistry::get().assign(this->_handle, ssbo_id);
   this->bind();
   glBufferData(GL_SHADER_STORAGE_BUFFER, sizeof(T) * buffer.size(), buffer.data(), GL_DYNAMIC_DRAW);
+  GpuMemoryTracker::get().track(GpuMemoryClassStorageBuffer, this->_handle.value, sizeof(T) * buffer.size());
   glBindBufferBase(GL_SHADER_STORAGE_BUFFER, binding, this->get_ssbo_id());
   this->_binding_id = binding;
   this->unbind();
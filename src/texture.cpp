@@ -5,18 +5,29 @@
 //
 #include <texture.hpp>
 #include <framebuffer.hpp>
+#include <render_target.hpp>
+#include <async_texture_loader.hpp>
+#include <texture_format.hpp>
+#include <compressed_texture.hpp>
+#include <asset_pack.hpp>
+#include <qoi.hpp>
+#include <image_ops.hpp>
+#include <gpu_memory_tracker.hpp>
+#include <algorithm>
+#include <bit>
+#include <fstream>
 #include <iostream>
+#include <iterator>
+#include <utility>
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
 
 namespace fre2d {
 Texture::Texture() noexcept
-    : _internal_format{detail::texture::default_internal_format} {
-  this->_texture_id = std::make_shared<GLuint>(0);
-}
+    : _internal_format{detail::texture::default_internal_format} {}
 
 Texture::Texture(GLuint texture_id) noexcept
-  : _texture_id{std::make_shared<GLuint>(texture_id)} {
+  : _handle{texture_id != 0 ? ResourceRegistry::get().create<ResourceTypeTexture>(texture_id) : TextureHandle{}} {
 }
 
 Texture::Texture(
@@ -25,48 +36,90 @@ Texture::Texture(
   GLsizei height,
   bool use_nearest,
   bool use_mipmap,
-  const WrapOptions& texture_wrap
+  const WrapOptions& texture_wrap,
+  TextureFormat format,
+  bool premultiply_alpha
 ) noexcept : _internal_format{detail::texture::default_internal_format} {
-  this->_texture_id = std::make_shared<GLuint>(0);
-  this->load(file_path, width, height, use_nearest, use_mipmap, texture_wrap);
+  this->load(file_path, width, height, use_nearest, use_mipmap, texture_wrap, format, premultiply_alpha);
 }
 
-Texture::~Texture() {
-  this->release();
+Texture::Texture(const Texture& texture) noexcept
+  : _handle{texture._handle},
+    _internal_format{texture._internal_format},
+    _format{texture._format},
+    _sampler{texture._sampler} {
+  ResourceRegistry::get().add_ref(this->_handle);
+}
+
+Texture::Texture(Texture&& texture) noexcept
+  : _handle{std::exchange(texture._handle, TextureHandle{})},
+    _internal_format{texture._internal_format},
+    _format{texture._format},
+    _sampler{texture._sampler} {}
+
+Texture& Texture::operator=(const Texture& texture) noexcept {
+  if(this != &texture) {
+    auto& registry = ResourceRegistry::get();
+    registry.add_ref(texture._handle);
+    registry.remove_ref(this->_handle);
+    this->_handle = texture._handle;
+    this->_internal_format = texture._internal_format;
+    this->_format = texture._format;
+    this->_sampler = texture._sampler;
+  }
+  return *this;
+}
+
+Texture& Texture::operator=(Texture&& texture) noexcept {
+  if(this != &texture) {
+    ResourceRegistry::get().remove_ref(this->_handle);
+    this->_handle = std::exchange(texture._handle, TextureHandle{});
+    this->_internal_format = texture._internal_format;
+    this->_format = texture._format;
+    this->_sampler = texture._sampler;
+  }
+  return *this;
+}
+
+Texture::~Texture() noexcept {
+  // null for never loaded ones; they don't need registry (which might be
+  // gone already, e.g. static ones at exit).
+  if(!this->_handle.is_null()) {
+    ResourceRegistry::get().remove_ref(this->_handle);
+  }
 }
 
-/// change _texture_id to texture_id with releasing current texture.
+/// change texture to texture_id with releasing current texture.
 void Texture::load(GLuint texture_id) noexcept {
   this->release();
-  this->_texture_id = std::make_shared<GLuint>(texture_id);
+  if(texture_id != 0) {
+    this->_handle = ResourceRegistry::get().create<ResourceTypeTexture>(texture_id);
+  }
 }
 
-/// change _texture_id to texture_id without releasing current texture.
-/// but you need to get_texture_id() before using this to manage/release it yourself.
+/// change texture to texture_id without releasing current texture.
+/// but you need to get_texture_id() before using this to manage/release it yourself;
+/// registry forgets it, so copies of this Texture see it as released.
 void Texture::load_override(GLuint texture_id) noexcept {
-  this->_texture_id = std::make_shared<GLuint>(texture_id);
+  ResourceRegistry::get().detach(this->_handle);
+  this->_handle = texture_id != 0 ? ResourceRegistry::get().create<ResourceTypeTexture>(texture_id) : TextureHandle{};
 }
 
-/// remove current Texture and set _texture_id to 0.
-/// if _texture_id is already 0, then no action will be performed.
+/// destroy current texture for every copy; ResourceRegistry deletes it.
+/// if texture is already released (or never loaded), then no action will be performed.
 void Texture::release() noexcept {
-  // we check for use_count because there might be multiple copies of this Texture;
-  // and when one of them goes out of scope, destructor will be called more than once,
-  // and then glDeleteTextures will set _texture_id to 0;
-  // other copies still would think _texture_id is have not still been released.
-  // but their _texture_id will probably be invalid.
-  if(this->get_texture_id() != 0 && this->_texture_id.use_count() == 1) {
-    glDeleteTextures(1, &*this->_texture_id);
-    *this->_texture_id = 0;
-  }
+  ResourceRegistry::get().destroy(this->_handle);
+  this->_handle = {};
 }
 
-void Texture::load(const char* file_path,
+bool Texture::load(const char* file_path,
                    GLsizei width,
                    GLsizei height,
                    bool use_nearest,
                    bool use_mipmap,
-                   const WrapOptions& texture_wrap) noexcept {
+                   const WrapOptions& texture_wrap,
+                   TextureFormat format,
+                   bool premultiply_alpha) noexcept {
   // width & height is -1 by default, if file_path is not nullptr,
   // then stb will automatically detect width and height;
   // but we added them as optional, so can be used to define them explicitly
@@ -78,8 +131,30 @@ void Texture::load(const char* file_path,
   int h { height != -1 ? height : 0 };
   int channels { 4 }; // since it's possible to pass file_path = nullptr, we initialize them first.
 
-  stbi_set_flip_vertically_on_load(true);
-  auto* image_data = file_path ? stbi_load(file_path, &w, &h, &channels, 0) : nullptr;
+  // qoi is decoded by us, several times faster than png through stb.
+  std::vector<std::uint8_t> qoi_bytes;
+  if(file_path && read_qoi_file(file_path, qoi_bytes)) {
+    QoiHeader qoi_header { 0, 0, 4, QoiSrgb };
+    if(!read_qoi_header(qoi_bytes.data(), qoi_bytes.size(), qoi_header) ||
+       !this->_load_qoi(qoi_bytes, qoi_header, use_nearest, use_mipmap, texture_wrap, format, premultiply_alpha)) {
+      // same as failed stb load below.
+      std::cout << "error: cannot load image file " << file_path << '\n';
+      return false;
+    }
+    this->_set_stream_source(file_path, use_nearest, use_mipmap, texture_wrap, format, premultiply_alpha);
+    return true;
+  }
+
+  // we flip (and premultiply) ourselves in one simd pass; thread variant
+  // since some other code on this thread might have set it.
+  stbi_set_flip_vertically_on_load_thread(false);
+  if(file_path) {
+    // gray (+ alpha) files are expanded; pick TextureFormatR8/Rg8 to store them compactly.
+    stbi_info(file_path, &w, &h, &channels);
+    channels = channels == 3 ? 3 : 4;
+  }
+  int channels_in_file { 0 };
+  auto* image_data = file_path ? stbi_load(file_path, &w, &h, &channels_in_file, channels) : nullptr;
 
   // file is specified but image data is nullptr.
   if(!image_data && file_path) {
@@ -89,27 +164,51 @@ void Texture::load(const char* file_path,
     // while(!glfwWindowShouldClose(window_ptr) && fre2d_is_running())
     // for errors; we will set explicitly fre2d_is_running bool instance value to false.
     std::cout << "error: cannot load image file " << file_path << '\n';
+    return false;
+  }
+  if(image_data) {
+    process_image(image_data, image_data, static_cast<std::uint32_t>(w), static_cast<std::uint32_t>(h), channels,
+                  ImageOps{true, premultiply_alpha, false});
   }
-  this->load_from_data(image_data, w, h, use_nearest, use_mipmap, texture_wrap, channels);
+  this->load_from_data(image_data, w, h, use_nearest, use_mipmap, texture_wrap, channels, format);
+  this->_set_stream_source(image_data ? file_path : nullptr, use_nearest, use_mipmap, texture_wrap, format,
+                           premultiply_alpha);
   if(image_data) {
     stbi_image_free(image_data);
   }
+  return true;
+}
+
+void Texture::load_async(AsyncTextureLoader& loader,
+                         const char* file_path,
+                         bool use_nearest,
+                         bool use_mipmap,
+                         const WrapOptions& texture_wrap,
+                         bool premultiply_alpha) noexcept {
+  // like other loads; previous texture is deleted by ResourceRegistry and every
+  // copy gets the new one once it's uploaded.
+  auto& registry = ResourceRegistry::get();
+  if(registry.is_valid(this->_handle)) {
+    registry.set_name(this->_handle, 0);
+  } else {
+    this->_handle = registry.create<ResourceTypeTexture>();
+  }
+  auto& tracker = GpuMemoryTracker::get();
+  tracker.track(GpuMemoryClassTexture, this->_handle.value, 0);
+  tracker.set_stream_source(this->_handle, file_path, use_nearest, use_mipmap, texture_wrap, premultiply_alpha);
+  loader._enqueue(this->_handle, file_path, use_nearest, use_mipmap, texture_wrap, premultiply_alpha);
 }
 
 void Texture::load_from_data(const unsigned char *image_data, GLsizei width, GLsizei height, bool use_nearest,
                              bool use_mipmap, const WrapOptions& texture_wrap,
-                             int channels) noexcept {
-  // we always store them as GL_RGBA in internal format; format may variate.
-  // precision is enough for 2D games but
-  // GL_RGB/GL_RGBA8 might be an option.
-  // TODO: add an option to set internal format.
-
+                             int channels, TextureFormat format) noexcept {
   // exclusive cases;
   // * use channels = -1 to set both _format and _internal_format to GL_RED
   // * use channels = -2 to set both _format and _internal_format to GL_GREEN
   // * use channels = -3 to set both _format and _internal_format to GL_BLUE
-  // otherwise, use 3 for GL_RGB; 4 for GL_RGBA; but _internal_format is always
-  // GL_RGBA.
+  // otherwise, use 3 for GL_RGB; 4 for GL_RGBA; _internal_format is given by
+  // format (GL_RGBA8 by default) and pixels are converted to it if needed.
+  const bool single_channel { channels == FormatRed || channels == FormatGreen || channels == FormatBlue };
   switch(channels) {
   case FormatRed: { this->_format = this->_internal_format = GL_RED; break; }
   case FormatGreen: { this->_format = this->_internal_format = GL_GREEN; break; }
@@ -117,13 +216,13 @@ void Texture::load_from_data(const unsigned char *image_data, GLsizei width, GLs
   default: { this->_format = channels == 4 ? GL_RGBA : GL_RGB; break; }
   }
   glActiveTexture(GL_TEXTURE0);
-  glGenTextures(1, &*this->_texture_id);
-  glBindTexture(GL_TEXTURE_2D, *this->_texture_id);
+  GLuint texture_id { 0 };
+  glGenTextures(1, &texture_id);
+  ResourceRegistry::get().assign(this->_handle, texture_id);
+  glBindTexture(GL_TEXTURE_2D, texture_id);
   // special case for FormatRed, FormatGreen and FormatBlue, mostly
   // used for Font class.
-  if(this->_format == GL_RED ||
-     this->_format == GL_GREEN ||
-     this->_format == GL_BLUE) {
+  if(single_channel) {
     // mutable; unlike glTextureStorage2D.
     glTexImage2D(
       GL_TEXTURE_2D,
@@ -136,21 +235,41 @@ void Texture::load_from_data(const unsigned char *image_data, GLsizei width, GLs
       GL_UNSIGNED_BYTE,
       image_data
     );
+    GpuMemoryTracker::get().track(GpuMemoryClassTexture, this->_handle.value, get_mip_chain_bytes(width, height, 1));
   } else {
-    // generate immutable storage for general purpose.
+    const auto info = get_texture_format_info(format, channels);
+    std::vector<std::uint8_t> converted;
+    // image_data is pbo offset (not pointer) when PixelUploadRing uploads;
+    // it only uses default format, so it never gets here.
+    if(info.needs_conversion && image_data) {
+      convert_pixels(image_data, channels, static_cast<std::size_t>(width) * height, format, converted);
+      image_data = converted.data();
+    }
+    this->_internal_format = static_cast<GLint>(info.internal_format);
+    this->_format = static_cast<GLint>(info.format);
+
+    // generate immutable storage for general purpose; with room for full mip
+    // chain, glGenerateTextureMipmap has nowhere to write otherwise.
+    // 1x1 is special case since we use it as default sampler2D.
+    const GLsizei levels {
+      use_mipmap ? static_cast<GLsizei>(std::bit_width(static_cast<unsigned>(std::max({width, height, 1})))) : 1
+    };
     glTextureStorage2D(
       this->get_texture_id(),
-      1,
+      levels,
       this->_internal_format,
       width,
       height
     );
+    GpuMemoryTracker::get().track(
+      GpuMemoryClassTexture,
+      this->_handle.value,
+      get_mip_chain_bytes(width, height, info.bytes_per_pixel, levels)
+    );
+    // rows of RGB, RG8, R8 and 16-bit formats are not always multiple of 4 bytes.
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
     // since we are dealing with C API,
     // passing NULL is probably more comprehensible than nullptr.
-    // file_path = nullptr -> _framebuffer_load(); if you want to pass raw pixels;
-    // it's not available yet but not hard to implement too. (would be great and
-    // easy TODO) then we can call it with parameters image_data, internal_format,
-    // width, height, format etc.
     glTextureSubImage2D(
       this->get_texture_id(),
       0,
@@ -159,47 +278,218 @@ void Texture::load_from_data(const unsigned char *image_data, GLsizei width, GLs
       width,
       height,
       this->_format,
-      GL_UNSIGNED_BYTE,
+      info.type,
       image_data ? image_data : NULL
     );
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+    // gray (+ alpha) formats look like RGBA to shaders; so they can be used
+    // with default shaders as is.
+    if(format == TextureFormatR8 || format == TextureFormatRg8) {
+      const GLint swizzle[4] { GL_RED, GL_RED, GL_RED, format == TextureFormatR8 ? GL_ONE : GL_GREEN };
+      glTextureParameteriv(this->get_texture_id(), GL_TEXTURE_SWIZZLE_RGBA, swizzle);
+    }
 
-    // 1x1 is special case since we use it as default sampler2D;
-    // also, 1x1s has nothing to do with mipmaps right?
-    if (use_mipmap && width != 1 && height != 1) {
+    if (levels > 1) {
       glGenerateTextureMipmap(this->get_texture_id());
     }
   }
-  this->set_parameters(use_nearest, use_mipmap, texture_wrap);
+  // FormatRed/Green/Blue storage is mutable with single level; mipmap filter
+  // would make it incomplete.
+  this->set_parameters(use_nearest, use_mipmap && !single_channel, texture_wrap);
 }
+
+void Texture::load_compressed(const char* file_path,
+                              bool use_nearest,
+                              bool use_mipmap,
+                              const WrapOptions& texture_wrap) noexcept {
+  std::ifstream file(file_path, std::ios::binary);
+  if(!file) {
+    std::cout << "error: cannot load compressed texture file " << file_path << '\n';
+    return;
+  }
+  const std::vector<std::uint8_t> data {
+    std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()
+  };
+  this->load_compressed_from_data(data.data(), data.size(), use_nearest, use_mipmap, texture_wrap);
+}
+
+void Texture::load_compressed_from_data(const std::uint8_t* data,
+                                        std::size_t size,
+                                        bool use_nearest,
+                                        bool use_mipmap,
+                                        const WrapOptions& texture_wrap) noexcept {
+  // blocks are uploaded straight from data (e.g. mapped AssetPack).
+  BlockFormat format;
+  std::vector<CompressedLevelView> image_levels;
+  if(!read_compressed_texture_levels(data, size, format, image_levels)) {
+    return;
+  }
+  if(!is_block_format_supported(format)) {
+    std::cout << "fre2d error: " << get_block_format_name(format)
+              << " textures are not supported by this driver.\n";
+    return;
+  }
+  const auto levels = use_mipmap ? image_levels.size() : 1;
+  this->_internal_format = static_cast<GLint>(get_block_format_internal_format(format));
+  this->_format = format == BlockFormatBc4 ? GL_RED : GL_RGBA;
+
+  GLuint texture_id { 0 };
+  glCreateTextures(GL_TEXTURE_2D, 1, &texture_id);
+  ResourceRegistry::get().assign(this->_handle, texture_id);
+  glTextureStorage2D(
+    this->get_texture_id(),
+    static_cast<GLsizei>(levels),
+    this->_internal_format,
+    static_cast<GLsizei>(image_levels.front().width),
+    static_cast<GLsizei>(image_levels.front().height)
+  );
+  std::size_t bytes { 0 };
+  for(std::size_t level = 0; level < levels; ++level) {
+    const auto& source = image_levels[level];
+    bytes += source.size;
+    glCompressedTextureSubImage2D(
+      this->get_texture_id(),
+      static_cast<GLint>(level),
+      0,
+      0,
+      static_cast<GLsizei>(source.width),
+      static_cast<GLsizei>(source.height),
+      this->_internal_format,
+      static_cast<GLsizei>(source.size),
+      source.blocks
+    );
+  }
+  auto& tracker = GpuMemoryTracker::get();
+  tracker.track(GpuMemoryClassTexture, this->_handle.value, bytes);
+  tracker.forget_stream_source(this->_handle);
+  if(format == BlockFormatBc4) {
+    const GLint swizzle[4] { GL_RED, GL_RED, GL_RED, GL_ONE };
+    glTextureParameteriv(this->get_texture_id(), GL_TEXTURE_SWIZZLE_RGBA, swizzle);
+  }
+  // file without mip chain would be incomplete with mipmap filter.
+  this->set_parameters(use_nearest, levels > 1, texture_wrap);
+}
+
+void Texture::load_from_pack(const AssetPack& pack,
+                             std::string_view name,
+                             bool use_nearest,
+                             bool use_mipmap,
+                             const WrapOptions& texture_wrap,
+                             TextureFormat format) noexcept {
+  const auto entry = pack.find(name);
+  if(!entry) {
+    std::cout << "error: no texture named " << name << " in asset pack\n";
+    return;
+  }
+  switch(entry->type) {
+  case AssetTypePixels: {
+    // pack could be corrupt; never let driver read past the mapping.
+    if(entry->channels != 3 && entry->channels != 4) {
+      std::cout << "error: " << name << " in asset pack has " << entry->channels << " channels, expected 3 or 4\n";
+      return;
+    }
+    const auto expected_size {
+      static_cast<std::size_t>(entry->width) * static_cast<std::size_t>(entry->height) * entry->channels
+    };
+    if(entry->width == 0 || entry->height == 0 || entry->size < expected_size) {
+      std::cout << "error: " << name << " in asset pack has " << entry->size << " bytes, expected "
+                << expected_size << " for " << entry->width << "x" << entry->height << "\n";
+      return;
+    }
+    this->load_from_data(
+      entry->data,
+      static_cast<GLsizei>(entry->width),
+      static_cast<GLsizei>(entry->height),
+      use_nearest,
+      use_mipmap,
+      texture_wrap,
+      static_cast<int>(entry->channels),
+      format
+    );
+    break;
+  }
+  case AssetTypeCompressed: {
+    this->load_compressed_from_data(entry->data, entry->size, use_nearest, use_mipmap, texture_wrap);
+    break;
+  }
+  default: {
+    std::cout << "error: " << name << " in asset pack is not a texture\n";
+    break;
+  }
+  }
+}
+
 void Texture::load_nothing(GLsizei width, GLsizei height, bool use_nearest, bool use_mipmap,
                            const WrapOptions& texture_wrap, int channels) noexcept {
   this->_format = channels == 4 ? GL_RGBA : GL_RGB;
-  glGenTextures(1, &*this->_texture_id);
-  glBindTexture(GL_TEXTURE_2D, *this->_texture_id);
+  GLuint texture_id { 0 };
+  glGenTextures(1, &texture_id);
+  ResourceRegistry::get().assign(this->_handle, texture_id);
+  glBindTexture(GL_TEXTURE_2D, texture_id);
+  glTexImage2D(GL_TEXTURE_2D, 0, this->_internal_format, width, height, 0, this->_format, GL_UNSIGNED_BYTE, NULL);
+  auto& tracker = GpuMemoryTracker::get();
+  tracker.track(
+    GpuMemoryClassTexture,
+    this->_handle.value,
+    get_mip_chain_bytes(width, height, get_internal_format_bytes(this->_internal_format))
+  );
+  tracker.forget_stream_source(this->_handle);
+  // single level; there is nothing to generate mipmaps from yet.
+  static_cast<void>(use_mipmap);
+  this->set_parameters(use_nearest, false, texture_wrap);
+}
+
+void Texture::_framebuffer_load(GLsizei width, GLsizei height, GLint internal_format) noexcept {
+  this->_internal_format = internal_format;
+  this->_format = detail::render_target::get_pixel_format(static_cast<ColorFormat>(internal_format));
+  const bool first_time { this->get_texture_id() == 0 };
+  if(first_time) {
+    GLuint texture_id { 0 };
+    glGenTextures(1, &texture_id);
+    ResourceRegistry::get().assign(this->_handle, texture_id);
+  }
+  glBindTexture(GL_TEXTURE_2D, this->get_texture_id());
   glTexImage2D(GL_TEXTURE_2D, 0, this->_internal_format, width, height, 0, this->_format, GL_UNSIGNED_BYTE, NULL);
-  this->set_parameters(use_nearest, use_mipmap, texture_wrap);
+  GpuMemoryTracker::get().track(
+    GpuMemoryClassTexture,
+    this->_handle.value,
+    get_mip_chain_bytes(width, height, get_internal_format_bytes(this->_internal_format))
+  );
+  if(first_time) {
+    this->set_parameters(false, false);
+  }
 }
 
 void Texture::set_parameters(bool use_nearest, bool use_mipmap, const WrapOptions& texture_wrap) noexcept {
-  glTextureParameteri(this->get_texture_id(), GL_TEXTURE_WRAP_S, texture_wrap.wrap_x_opt);
-  glTextureParameteri(this->get_texture_id(), GL_TEXTURE_WRAP_T, texture_wrap.wrap_y_opt);
-  if(use_nearest) {
-    glTextureParameteri(this->get_texture_id(), GL_TEXTURE_MIN_FILTER,
-                        use_mipmap ? GL_NEAREST_MIPMAP_NEAREST : GL_NEAREST);
-    glTextureParameteri(this->get_texture_id(), GL_TEXTURE_MAG_FILTER,
-                        GL_NEAREST);
-  } else {
-    glTextureParameteri(this->get_texture_id(), GL_TEXTURE_MIN_FILTER,
-                        use_mipmap ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
-    glTextureParameteri(this->get_texture_id(), GL_TEXTURE_MAG_FILTER,
-                        GL_LINEAR);
+  SamplerDesc desc {
+    static_cast<GLenum>(use_nearest ? (use_mipmap ? GL_NEAREST_MIPMAP_NEAREST : GL_NEAREST)
+                                    : (use_mipmap ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR)),
+    static_cast<GLenum>(use_nearest ? GL_NEAREST : GL_LINEAR),
+    texture_wrap.wrap_x_opt,
+    texture_wrap.wrap_y_opt,
+    this->_sampler ? this->_sampler->anisotropy : detail::sampler_cache::default_anisotropy
+  };
+  this->_set_sampler(desc);
+}
+
+void Texture::set_anisotropy(GLfloat anisotropy) noexcept {
+  if(!this->_sampler) {
+    std::cout << "fre2d error: Texture::set_anisotropy(): texture has no sampler state, load it first.\n";
+    return;
   }
+  auto desc = *this->_sampler;
+  desc.anisotropy = std::clamp(anisotropy, 1.f, SamplerCache::get_max_anisotropy());
+  this->_set_sampler(desc);
 }
 
 // generates 1x1 transparent texture that used as default uniform texture to
-// prevent UB.
+// prevent UB. one per thread; since contexts are not shared, texture name
+// created on one thread's context is meaningless on another one.
 [[nodiscard]] const Texture& Texture::get_default_texture() noexcept {
-  static Texture default_texture;
+  // registry is created first; so it's destroyed after default texture on thread exit.
+  static_cast<void>(ResourceRegistry::get());
+  thread_local Texture default_texture;
   if(default_texture.get_texture_id() == 0) {
     default_texture.load_from_data(detail::texture::default_transparent_pixel);
   }
@@ -207,8 +497,28 @@ void Texture::set_parameters(bool use_nearest, bool use_mipmap, const WrapOption
 }
 
 void Texture::bind(GLuint texture_unit) const noexcept {
+  Texture::bind(this->_handle, texture_unit);
+}
+
+void Texture::bind(TextureHandle handle, GLuint texture_unit) noexcept {
   // TODO: check for maximum texture units
-  glBindTextureUnit(texture_unit, this->get_texture_id());
+  // marks texture as used; evicted one is queued for reload here. skipped
+  // (no map lookup per draw) unless streaming is on.
+  if(auto& tracker = GpuMemoryTracker::get(); tracker.is_streaming()) {
+    tracker.touch(handle);
+  }
+  const auto& registry = ResourceRegistry::get();
+  const GLuint texture_id { registry.get_name(handle) };
+  // id is 0 while load_async() is in progress (or never loaded, or evicted);
+  // default texture keeps sampler complete instead of unbinding unit.
+  if(texture_id == 0) {
+    Texture::get_default_texture().bind(texture_unit);
+    return;
+  }
+  glBindTextureUnit(texture_unit, texture_id);
+  // sampler stays bound to unit; so unit must always be overwritten, even
+  // with 0 for wrapped textures.
+  glBindSampler(texture_unit, registry.get_texture_sampler(handle));
 }
 
 void Texture::unbind() const noexcept {
@@ -217,10 +527,95 @@ void Texture::unbind() const noexcept {
 
 void Texture::attach(const Framebuffer& fb, GLuint attachment) const noexcept {
   glBindFramebuffer(GL_FRAMEBUFFER, fb.get_fbo_id());
-  glFramebufferTexture2D(GL_FRAMEBUFFER, attachment, GL_TEXTURE_2D, *this->_texture_id, 0);
+  glFramebufferTexture2D(GL_FRAMEBUFFER, attachment, GL_TEXTURE_2D, this->get_texture_id(), 0);
+}
+
+[[nodiscard]] bool Texture::_load_qoi(const std::vector<std::uint8_t>& bytes,
+                                     const QoiHeader& header,
+                                     bool use_nearest,
+                                     bool use_mipmap,
+                                     const WrapOptions& texture_wrap,
+                                     TextureFormat format,
+                                     bool premultiply_alpha) noexcept {
+  const auto size = static_cast<std::size_t>(header.width) * header.height * header.channels;
+  const auto width = static_cast<GLsizei>(header.width);
+  const auto height = static_cast<GLsizei>(header.height);
+  // converted and premultiplied pixels need a cpu pass after decoding anyway
+  // (and mapped memory is slow to read); others are decoded straight into
+  // pixel unpack buffer, like AsyncTextureLoader does into its ring. so
+  // there's no staging copy and gpu copies them into texture.
+  if(!premultiply_alpha && !get_texture_format_info(format, header.channels).needs_conversion) {
+    GLuint buffer_id { 0 };
+    glCreateBuffers(1, &buffer_id);
+    glNamedBufferStorage(buffer_id, static_cast<GLsizeiptr>(size), nullptr, GL_MAP_WRITE_BIT);
+    auto* destination = static_cast<std::uint8_t*>(glMapNamedBufferRange(
+      buffer_id, 0, static_cast<GLsizeiptr>(size), GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT
+    ));
+    if(destination) {
+      bool loaded { decode_qoi(bytes.data(), bytes.size(), destination, header.channels, true) };
+      // GL_FALSE means contents are lost (e.g. display mode change).
+      loaded = glUnmapNamedBuffer(buffer_id) == GL_TRUE && loaded;
+      if(loaded) {
+        // data pointer is offset into bound unpack buffer; see PixelUploadRing::upload().
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer_id);
+        this->load_from_data(nullptr, width, height, use_nearest, use_mipmap, texture_wrap, header.channels, format);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+      }
+      // driver keeps it alive until copy is done.
+      glDeleteBuffers(1, &buffer_id);
+      return loaded;
+    }
+    // cannot map; decode into client memory instead.
+    glDeleteBuffers(1, &buffer_id);
+  }
+  std::vector<std::uint8_t> pixels(size);
+  if(!decode_qoi(bytes.data(), bytes.size(), pixels.data(), header.channels, true)) {
+    return false;
+  }
+  if(premultiply_alpha) {
+    // decoder already flipped rows.
+    process_image(pixels.data(), pixels.data(), header.width, header.height, header.channels,
+                  ImageOps{false, true, false});
+  }
+  this->load_from_data(pixels.data(), width, height, use_nearest, use_mipmap, texture_wrap, header.channels, format);
+  return true;
+}
+
+void Texture::_set_sampler(const SamplerDesc& desc) noexcept {
+  glTextureParameteri(this->get_texture_id(), GL_TEXTURE_WRAP_S, desc.wrap_s);
+  glTextureParameteri(this->get_texture_id(), GL_TEXTURE_WRAP_T, desc.wrap_t);
+  glTextureParameteri(this->get_texture_id(), GL_TEXTURE_MIN_FILTER, desc.min_filter);
+  glTextureParameteri(this->get_texture_id(), GL_TEXTURE_MAG_FILTER, desc.mag_filter);
+  this->_sampler = desc;
+  ResourceRegistry::get().set_texture_sampler(this->_handle, SamplerCache::get().get_sampler(desc));
+  // evicted texture gets it back once it's reloaded.
+  GpuMemoryTracker::get().set_stream_sampler(this->_handle, desc);
+}
+
+void Texture::_set_stream_source(const char* file_path,
+                                 bool use_nearest,
+                                 bool use_mipmap,
+                                 const WrapOptions& texture_wrap,
+                                 TextureFormat format,
+                                 bool premultiply_alpha) const noexcept {
+  // async loader uploads default format only; so only those can be reloaded.
+  if(file_path && format == detail::texture::default_format) {
+    GpuMemoryTracker::get().set_stream_source(this->_handle, file_path, use_nearest, use_mipmap, texture_wrap,
+                                              premultiply_alpha);
+  } else {
+    GpuMemoryTracker::get().forget_stream_source(this->_handle);
+  }
+}
+
+[[nodiscard]] GLuint Texture::get_texture_id() const noexcept {
+  return ResourceRegistry::get().get_name(this->_handle);
+}
+
+[[nodiscard]] const TextureHandle& Texture::get_handle() const noexcept {
+  return this->_handle;
 }
 
-[[nodiscard]] const GLuint& Texture::get_texture_id() const noexcept {
-  return *this->_texture_id;
+[[nodiscard]] const std::optional<SamplerDesc>& Texture::get_sampler_desc() const noexcept {
+  return this->_sampler;
 }
 } // namespace fre2d
\ No newline at end of file
@@ -0,0 +1,350 @@
+// MIT License
+//
+// Copyright (c) 2025 Ferhat Geçdoğan All Rights Reserved.
+// Distributed under the terms of the MIT License.
+//
+#include <texture_atlas.hpp>
+#include <image_ops.hpp>
+#include <gpu_memory_tracker.hpp>
+#include <algorithm>
+#include <bit>
+#include <iostream>
+#include <limits>
+#include <stb_image.h>
+
+namespace fre2d {
+TextureAtlas::TextureAtlas(GLsizei page_size,
+                           GLsizei padding,
+                           bool use_nearest,
+                           bool use_mipmap,
+                           std::size_t max_pages,
+                           bool use_array) noexcept
+  : _page_size{std::max(page_size, 1)},
+    _padding{std::max(padding, 0)},
+    _mip_levels{1},
+    _use_nearest{use_nearest},
+    _use_mipmap{use_mipmap},
+    _use_array{use_array},
+    _max_pages{max_pages},
+    _layer_capacity{0} {
+  if(use_mipmap) {
+    // level k reads 2^k x 2^k blocks; they stay inside gutter while 2^k <= padding.
+    const auto padding_levels = static_cast<GLsizei>(std::bit_width(static_cast<unsigned>(std::max(this->_padding, 1))));
+    const auto page_levels = static_cast<GLsizei>(std::bit_width(static_cast<unsigned>(this->_page_size)));
+    this->_mip_levels = std::min(padding_levels, page_levels);
+  }
+}
+
+[[nodiscard]] std::optional<AtlasRegion> TextureAtlas::insert(const unsigned char* pixels,
+                                                              GLsizei width,
+                                                              GLsizei height,
+                                                              int channels) noexcept {
+  if(!pixels || width <= 0 || height <= 0 || (channels != 3 && channels != 4)) {
+    std::cout << "fre2d error: TextureAtlas::insert(): invalid image.\n";
+    return std::nullopt;
+  }
+  // blocks are kept aligned to coarsest mip level, so its texels don't straddle
+  // two images.
+  const GLsizei alignment { 1 << (this->_mip_levels - 1) };
+  const auto align_up = [alignment](GLsizei value) {
+    return (value + alignment - 1) / alignment * alignment;
+  };
+  const GLsizei block_width { align_up(width + this->_padding * 2) };
+  const GLsizei block_height { align_up(height + this->_padding * 2) };
+  if(block_width > this->_page_size || block_height > this->_page_size) {
+    std::cout << "fre2d error: TextureAtlas::insert(): " << width << 'x' << height
+              << " image does not fit into " << this->_page_size << " page.\n";
+    return std::nullopt;
+  }
+
+  std::size_t page_index { 0 }, node_index { 0 };
+  GLsizei x { 0 }, y { 0 };
+  for(; page_index < this->_pages.size(); ++page_index) {
+    if(this->_find_position(this->_pages[page_index], block_width, block_height, node_index, x, y)) {
+      break;
+    }
+  }
+  if(page_index == this->_pages.size()) {
+    if(this->_max_pages != 0 && this->_pages.size() >= this->_max_pages) {
+      std::cout << "fre2d error: TextureAtlas::insert(): every page is full.\n";
+      return std::nullopt;
+    }
+    this->_add_page();
+    // empty page always has room, checked above.
+    static_cast<void>(this->_find_position(this->_pages.back(), block_width, block_height, node_index, x, y));
+  }
+  auto& page = this->_pages[page_index];
+  this->_place(page, node_index, x, y, block_width, block_height);
+
+  // gutter repeats edge pixels (clamp), so filtering at image border samples
+  // the image itself instead of neighbour.
+  std::vector<unsigned char> block(static_cast<std::size_t>(block_width) * block_height * 4);
+  for(GLsizei by = 0; by < block_height; ++by) {
+    const GLsizei sy { std::clamp(by - this->_padding, 0, height - 1) };
+    for(GLsizei bx = 0; bx < block_width; ++bx) {
+      const GLsizei sx { std::clamp(bx - this->_padding, 0, width - 1) };
+      const auto* source = pixels + (static_cast<std::size_t>(sy) * width + sx) * channels;
+      auto* destination = block.data() + (static_cast<std::size_t>(by) * block_width + bx) * 4;
+      destination[0] = source[0];
+      destination[1] = source[1];
+      destination[2] = source[2];
+      destination[3] = channels == 4 ? source[3] : 255;
+    }
+  }
+  if(this->_use_array) {
+    glTextureSubImage3D(
+      page.texture.get_texture_id(),
+      0,
+      x,
+      y,
+      static_cast<GLint>(page_index),
+      block_width,
+      block_height,
+      1,
+      GL_RGBA,
+      GL_UNSIGNED_BYTE,
+      block.data()
+    );
+  } else {
+    glTextureSubImage2D(
+      page.texture.get_texture_id(),
+      0,
+      x,
+      y,
+      block_width,
+      block_height,
+      GL_RGBA,
+      GL_UNSIGNED_BYTE,
+      block.data()
+    );
+  }
+  page.used_area += static_cast<std::size_t>(block_width) * block_height;
+  page.mipmaps_dirty = true;
+
+  const auto size = static_cast<float>(this->_page_size);
+  return AtlasRegion {
+    page_index,
+    glm::vec2(static_cast<float>(x + this->_padding) / size, static_cast<float>(y + this->_padding) / size),
+    glm::vec2(static_cast<float>(x + this->_padding + width) / size, static_cast<float>(y + this->_padding + height) / size),
+    width,
+    height
+  };
+}
+
+[[nodiscard]] std::optional<AtlasRegion> TextureAtlas::insert(const char* file_path) noexcept {
+  int width { 0 }, height { 0 }, channels { 0 };
+  stbi_set_flip_vertically_on_load_thread(false); // flipped below, like Texture::load().
+  stbi_info(file_path, &width, &height, &channels);
+  const int desired_channels { channels == 3 ? 3 : 4 };
+  auto* pixels = stbi_load(file_path, &width, &height, &channels, desired_channels);
+  if(!pixels) {
+    std::cout << "error: cannot load image file " << file_path << '\n';
+    return std::nullopt;
+  }
+  process_image(pixels, pixels, static_cast<std::uint32_t>(width), static_cast<std::uint32_t>(height),
+                desired_channels, ImageOps{true, false, false});
+  auto region = this->insert(pixels, width, height, desired_channels);
+  stbi_image_free(pixels);
+  return region;
+}
+
+void TextureAtlas::update_mipmaps() noexcept {
+  bool array_dirty { false };
+  for(auto& page: this->_pages) {
+    if(page.mipmaps_dirty && this->_mip_levels > 1) {
+      if(this->_use_array) {
+        array_dirty = true; // every layer shares one texture; generate once.
+      } else {
+        glGenerateTextureMipmap(page.texture.get_texture_id());
+      }
+    }
+    page.mipmaps_dirty = false;
+  }
+  if(array_dirty) {
+    glGenerateTextureMipmap(this->_pages.front().texture.get_texture_id());
+  }
+}
+
+[[nodiscard]] const Texture& TextureAtlas::get_page(std::size_t index) const noexcept {
+  if(index >= this->_pages.size()) {
+    std::cout << "fre2d error: TextureAtlas::get_page(): there is no page " << index << ".\n";
+    return Texture::get_default_texture();
+  }
+  return this->_pages[index].texture;
+}
+
+[[nodiscard]] std::size_t TextureAtlas::get_page_count() const noexcept {
+  return this->_pages.size();
+}
+
+[[nodiscard]] const GLsizei& TextureAtlas::get_page_size() const noexcept {
+  return this->_page_size;
+}
+
+[[nodiscard]] const GLsizei& TextureAtlas::get_padding() const noexcept {
+  return this->_padding;
+}
+
+[[nodiscard]] const bool& TextureAtlas::is_array() const noexcept {
+  return this->_use_array;
+}
+
+[[nodiscard]] float TextureAtlas::get_occupancy() const noexcept {
+  if(this->_pages.empty()) {
+    return 0.f;
+  }
+  std::size_t used_area { 0 };
+  for(const auto& page: this->_pages) {
+    used_area += page.used_area;
+  }
+  return static_cast<float>(used_area) /
+         (static_cast<float>(this->_page_size) * static_cast<float>(this->_page_size) * static_cast<float>(this->_pages.size()));
+}
+
+[[nodiscard]] bool TextureAtlas::_find_position(const Page& page,
+                                                GLsizei width,
+                                                GLsizei height,
+                                                std::size_t& node_index,
+                                                GLsizei& x,
+                                                GLsizei& y) const noexcept {
+  GLsizei best_top { std::numeric_limits<GLsizei>::max() };
+  GLsizei best_width { std::numeric_limits<GLsizei>::max() };
+  bool found { false };
+  for(std::size_t i = 0; i < page.skyline.size(); ++i) {
+    const auto& node = page.skyline[i];
+    if(node.x + width > this->_page_size) {
+      break; // nodes are sorted by x; rest are even further right.
+    }
+    // block rests on highest node it spans.
+    GLsizei top { node.y };
+    GLsizei remaining { width };
+    for(std::size_t j = i; remaining > 0; ++j) {
+      top = std::max(top, page.skyline[j].y);
+      remaining -= page.skyline[j].width;
+    }
+    if(top + height > this->_page_size) {
+      continue;
+    }
+    if(top + height < best_top || (top + height == best_top && node.width < best_width)) {
+      best_top = top + height;
+      best_width = node.width;
+      node_index = i;
+      x = node.x;
+      y = top;
+      found = true;
+    }
+  }
+  return found;
+}
+
+void TextureAtlas::_place(Page& page, std::size_t node_index, GLsizei x, GLsizei y, GLsizei width, GLsizei height) noexcept {
+  auto& skyline = page.skyline;
+  skyline.insert(skyline.begin() + static_cast<std::ptrdiff_t>(node_index), SkylineNode{x, y + height, width});
+
+  // nodes under new one are covered; shrink or remove them.
+  for(std::size_t i = node_index + 1; i < skyline.size();) {
+    const auto& previous = skyline[i - 1];
+    const GLsizei overlap { previous.x + previous.width - skyline[i].x };
+    if(overlap <= 0) {
+      break;
+    }
+    if(skyline[i].width <= overlap) {
+      skyline.erase(skyline.begin() + static_cast<std::ptrdiff_t>(i));
+      continue;
+    }
+    skyline[i].x += overlap;
+    skyline[i].width -= overlap;
+    break;
+  }
+
+  // merge neighbours at same height.
+  for(std::size_t i = 0; i + 1 < skyline.size();) {
+    if(skyline[i].y == skyline[i + 1].y) {
+      skyline[i].width += skyline[i + 1].width;
+      skyline.erase(skyline.begin() + static_cast<std::ptrdiff_t>(i + 1));
+    } else {
+      ++i;
+    }
+  }
+}
+
+void TextureAtlas::_add_page() noexcept {
+  if(!this->_use_array) {
+    this->_pages.push_back(Page{
+      Texture(this->_create_storage(0)),
+      { SkylineNode{0, 0, this->_page_size} },
+      0,
+      false
+    });
+    this->_pages.back().texture.set_parameters(this->_use_nearest, this->_mip_levels > 1);
+    this->_track_storage(this->_pages.back().texture, 1);
+    return;
+  }
+
+  if(this->_pages.empty()) {
+    this->_layer_capacity = 1;
+    this->_pages.push_back(Page{
+      Texture(this->_create_storage(this->_layer_capacity)),
+      { SkylineNode{0, 0, this->_page_size} },
+      0,
+      false
+    });
+    this->_pages.back().texture.set_parameters(this->_use_nearest, this->_mip_levels > 1);
+    this->_track_storage(this->_pages.back().texture, this->_layer_capacity);
+    return;
+  }
+
+  auto texture = this->_pages.front().texture;
+  if(static_cast<GLsizei>(this->_pages.size()) == this->_layer_capacity) {
+    // layer count of immutable storage is fixed; copy into bigger one on gpu.
+    GLsizei new_capacity { this->_layer_capacity * 2 };
+    if(this->_max_pages != 0) {
+      new_capacity = std::min(new_capacity, static_cast<GLsizei>(this->_max_pages));
+    }
+    const GLuint new_texture_id { this->_create_storage(new_capacity) };
+    for(GLsizei level = 0; level < this->_mip_levels; ++level) {
+      const GLsizei level_size { std::max(this->_page_size >> level, 1) };
+      glCopyImageSubData(
+        texture.get_texture_id(), GL_TEXTURE_2D_ARRAY, level, 0, 0, 0,
+        new_texture_id, GL_TEXTURE_2D_ARRAY, level, 0, 0, 0,
+        level_size, level_size, this->_layer_capacity
+      );
+    }
+    // handle is shared; every page (and Rectangle holding it) follows.
+    // old storage is deleted by ResourceRegistry.
+    ResourceRegistry::get().set_name(texture._handle, new_texture_id);
+    texture.set_parameters(this->_use_nearest, this->_mip_levels > 1);
+    this->_track_storage(texture, new_capacity);
+    this->_layer_capacity = new_capacity;
+  }
+  this->_pages.push_back(Page{
+    texture,
+    { SkylineNode{0, 0, this->_page_size} },
+    0,
+    false
+  });
+}
+
+[[nodiscard]] GLuint TextureAtlas::_create_storage(GLsizei layers) const noexcept {
+  GLuint texture_id { 0 };
+  if(layers == 0) {
+    glCreateTextures(GL_TEXTURE_2D, 1, &texture_id);
+    glTextureStorage2D(texture_id, this->_mip_levels, GL_RGBA8, this->_page_size, this->_page_size);
+  } else {
+    glCreateTextures(GL_TEXTURE_2D_ARRAY, 1, &texture_id);
+    glTextureStorage3D(texture_id, this->_mip_levels, GL_RGBA8, this->_page_size, this->_page_size, layers);
+  }
+  // unused space stays transparent.
+  glClearTexImage(texture_id, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+  glTextureParameteri(texture_id, GL_TEXTURE_MAX_LEVEL, this->_mip_levels - 1);
+  return texture_id;
+}
+
+void TextureAtlas::_track_storage(const Texture& texture, GLsizei layers) const noexcept {
+  GpuMemoryTracker::get().track(
+    GpuMemoryClassTexture,
+    texture.get_handle().value,
+    get_mip_chain_bytes(this->_page_size, this->_page_size, 4, this->_mip_levels) * static_cast<std::size_t>(layers)
+  );
+}
+} // namespace fre2d
\ No newline at end of file
@@ -0,0 +1,215 @@
+// MIT License
+//
+// Copyright (c) 2025 Ferhat Geçdoğan All Rights Reserved.
+// Distributed under the terms of the MIT License.
+//
+#include <texture_format.hpp>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  define FRE2D_TEXTURE_FORMAT_SSE2
+#  include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#  define FRE2D_TEXTURE_FORMAT_NEON
+#  include <arm_neon.h>
+#endif
+
+namespace fre2d {
+namespace {
+[[nodiscard]] std::uint16_t pack_rgb565(std::uint8_t r, std::uint8_t g, std::uint8_t b) noexcept {
+  return static_cast<std::uint16_t>(((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3));
+}
+
+[[nodiscard]] std::uint16_t pack_rgba4(std::uint8_t r, std::uint8_t g, std::uint8_t b, std::uint8_t a) noexcept {
+  return static_cast<std::uint16_t>(((r & 0xF0) << 8) | ((g & 0xF0) << 4) | (b & 0xF0) | (a >> 4));
+}
+
+// converts pixels [first, pixel_count); used for tails and RGB sources.
+void convert_scalar(const std::uint8_t* source,
+                    int channels,
+                    std::size_t first,
+                    std::size_t pixel_count,
+                    TextureFormat format,
+                    std::uint8_t* destination) noexcept {
+  for(std::size_t i = first; i < pixel_count; ++i) {
+    const auto* pixel = source + i * static_cast<std::size_t>(channels);
+    const std::uint8_t alpha { channels == 4 ? pixel[3] : std::uint8_t{255} };
+    switch(format) {
+    case TextureFormatR8: { destination[i] = pixel[0]; break; }
+    case TextureFormatRg8: {
+      destination[i * 2] = pixel[0];
+      destination[i * 2 + 1] = alpha;
+      break;
+    }
+    case TextureFormatRgb565: {
+      const auto value = pack_rgb565(pixel[0], pixel[1], pixel[2]);
+      std::memcpy(destination + i * 2, &value, sizeof(value));
+      break;
+    }
+    case TextureFormatRgba4: {
+      const auto value = pack_rgba4(pixel[0], pixel[1], pixel[2], alpha);
+      std::memcpy(destination + i * 2, &value, sizeof(value));
+      break;
+    }
+    default: {
+      std::memcpy(destination + i * 4, pixel, 3);
+      destination[i * 4 + 3] = alpha;
+      break;
+    }
+    }
+  }
+}
+
+#if defined(FRE2D_TEXTURE_FORMAT_SSE2)
+// keeps low 16 bits of each 32-bit lane; packs_epi32 would saturate them.
+[[nodiscard]] __m128i pack_low16(__m128i lhs, __m128i rhs) noexcept {
+  return _mm_packs_epi32(
+    _mm_srai_epi32(_mm_slli_epi32(lhs, 16), 16),
+    _mm_srai_epi32(_mm_slli_epi32(rhs, 16), 16)
+  );
+}
+
+// RGBA pixel per 32-bit lane (little endian: r is lowest byte).
+[[nodiscard]] __m128i to_rg8(__m128i pixels) noexcept {
+  return _mm_or_si128(
+    _mm_and_si128(pixels, _mm_set1_epi32(0xFF)),
+    _mm_and_si128(_mm_srli_epi32(pixels, 16), _mm_set1_epi32(0xFF00))
+  );
+}
+
+[[nodiscard]] __m128i to_rgb565(__m128i pixels) noexcept {
+  const auto r = _mm_slli_epi32(_mm_and_si128(pixels, _mm_set1_epi32(0xF8)), 8);
+  const auto g = _mm_slli_epi32(_mm_and_si128(_mm_srli_epi32(pixels, 8), _mm_set1_epi32(0xFC)), 3);
+  const auto b = _mm_srli_epi32(_mm_and_si128(_mm_srli_epi32(pixels, 16), _mm_set1_epi32(0xFF)), 3);
+  return _mm_or_si128(_mm_or_si128(r, g), b);
+}
+
+[[nodiscard]] __m128i to_rgba4(__m128i pixels) noexcept {
+  const auto r = _mm_slli_epi32(_mm_and_si128(pixels, _mm_set1_epi32(0xF0)), 8);
+  const auto g = _mm_slli_epi32(_mm_and_si128(_mm_srli_epi32(pixels, 8), _mm_set1_epi32(0xF0)), 4);
+  const auto b = _mm_and_si128(_mm_srli_epi32(pixels, 16), _mm_set1_epi32(0xF0));
+  const auto a = _mm_srli_epi32(pixels, 28);
+  return _mm_or_si128(_mm_or_si128(r, g), _mm_or_si128(b, a));
+}
+
+// returns number of converted pixels.
+std::size_t convert_rgba_simd(const std::uint8_t* source,
+                              std::size_t pixel_count,
+                              TextureFormat format,
+                              std::uint8_t* destination) noexcept {
+  std::size_t i { 0 };
+  if(format == TextureFormatR8) {
+    const auto mask = _mm_set1_epi32(0xFF);
+    for(; i + 16 <= pixel_count; i += 16) {
+      const auto* in = reinterpret_cast<const __m128i*>(source + i * 4);
+      const auto lo = _mm_packs_epi32(_mm_and_si128(_mm_loadu_si128(in), mask),
+                                      _mm_and_si128(_mm_loadu_si128(in + 1), mask));
+      const auto hi = _mm_packs_epi32(_mm_and_si128(_mm_loadu_si128(in + 2), mask),
+                                      _mm_and_si128(_mm_loadu_si128(in + 3), mask));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), _mm_packus_epi16(lo, hi));
+    }
+    return i;
+  }
+  // every other compact format is 16 bits per pixel.
+  const auto convert = format == TextureFormatRg8 ? to_rg8 : format == TextureFormatRgb565 ? to_rgb565 : to_rgba4;
+  for(; i + 8 <= pixel_count; i += 8) {
+    const auto* in = reinterpret_cast<const __m128i*>(source + i * 4);
+    const auto packed = pack_low16(convert(_mm_loadu_si128(in)), convert(_mm_loadu_si128(in + 1)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i * 2), packed);
+  }
+  return i;
+}
+#elif defined(FRE2D_TEXTURE_FORMAT_NEON)
+std::size_t convert_rgba_simd(const std::uint8_t* source,
+                              std::size_t pixel_count,
+                              TextureFormat format,
+                              std::uint8_t* destination) noexcept {
+  std::size_t i { 0 };
+  for(; i + 16 <= pixel_count; i += 16) {
+    const auto pixels = vld4q_u8(source + i * 4); // deinterleaved r, g, b, a
+    switch(format) {
+    case TextureFormatR8: { vst1q_u8(destination + i, pixels.val[0]); break; }
+    case TextureFormatRg8: { vst2q_u8(destination + i * 2, uint8x16x2_t{{pixels.val[0], pixels.val[3]}}); break; }
+    default: {
+      for(int half = 0; half < 2; ++half) {
+        const auto pick = [half](uint8x16_t value) {
+          return vmovl_u8(half == 0 ? vget_low_u8(value) : vget_high_u8(value));
+        };
+        const auto r = pick(pixels.val[0]), g = pick(pixels.val[1]);
+        const auto b = pick(pixels.val[2]), a = pick(pixels.val[3]);
+        const auto packed = format == TextureFormatRgb565
+          ? vorrq_u16(vorrq_u16(vshlq_n_u16(vandq_u16(r, vdupq_n_u16(0xF8)), 8),
+                                vshlq_n_u16(vandq_u16(g, vdupq_n_u16(0xFC)), 3)),
+                      vshrq_n_u16(b, 3))
+          : vorrq_u16(vorrq_u16(vshlq_n_u16(vandq_u16(r, vdupq_n_u16(0xF0)), 8),
+                                vshlq_n_u16(vandq_u16(g, vdupq_n_u16(0xF0)), 4)),
+                      vorrq_u16(vandq_u16(b, vdupq_n_u16(0xF0)), vshrq_n_u16(a, 4)));
+        vst1q_u16(reinterpret_cast<std::uint16_t*>(destination + (i + half * 8) * 2), packed);
+      }
+      break;
+    }
+    }
+  }
+  return i;
+}
+#endif
+} // anonymous namespace
+
+[[nodiscard]] TextureFormatInfo get_texture_format_info(TextureFormat format, int source_channels) noexcept {
+  const GLenum source_format { static_cast<GLenum>(source_channels == 3 ? GL_RGB : GL_RGBA) };
+  switch(format) {
+  case TextureFormatSrgb8Alpha8: { return {GL_SRGB8_ALPHA8, source_format, GL_UNSIGNED_BYTE, 4, false}; }
+  case TextureFormatRgb565: { return {GL_RGB565, GL_RGB, GL_UNSIGNED_SHORT_5_6_5, 2, true}; }
+  case TextureFormatRgba4: { return {GL_RGBA4, GL_RGBA, GL_UNSIGNED_SHORT_4_4_4_4, 2, true}; }
+  case TextureFormatRg8: { return {GL_RG8, GL_RG, GL_UNSIGNED_BYTE, 2, true}; }
+  case TextureFormatR8: { return {GL_R8, GL_RED, GL_UNSIGNED_BYTE, 1, true}; }
+  default: { return {GL_RGBA8, source_format, GL_UNSIGNED_BYTE, 4, false}; }
+  }
+}
+
+void convert_pixels(const std::uint8_t* source,
+                    int source_channels,
+                    std::size_t pixel_count,
+                    TextureFormat format,
+                    std::vector<std::uint8_t>& destination) noexcept {
+  destination.resize(pixel_count * get_texture_format_info(format).bytes_per_pixel);
+  std::size_t converted { 0 };
+#if defined(FRE2D_TEXTURE_FORMAT_SSE2) || defined(FRE2D_TEXTURE_FORMAT_NEON)
+  if(source_channels == 4 && get_texture_format_info(format).needs_conversion) {
+    converted = convert_rgba_simd(source, pixel_count, format, destination.data());
+  }
+#endif
+  convert_scalar(source, source_channels, converted, pixel_count, format, destination.data());
+}
+
+[[nodiscard]] TextureFormat suggest_texture_format(const std::uint8_t* pixels,
+                                                   int channels,
+                                                   std::size_t pixel_count,
+                                                   bool allow_lossy) noexcept {
+  bool gray { true };
+  bool opaque { true };
+  for(std::size_t i = 0; i < pixel_count && (gray || opaque); ++i) {
+    const auto* pixel = pixels + i * static_cast<std::size_t>(channels);
+    gray = gray && pixel[0] == pixel[1] && pixel[1] == pixel[2];
+    opaque = opaque && (channels == 3 || pixel[3] == 255);
+  }
+  if(gray) {
+    return opaque ? TextureFormatR8 : TextureFormatRg8;
+  }
+  if(allow_lossy) {
+    return opaque ? TextureFormatRgb565 : TextureFormatRgba4;
+  }
+  return TextureFormatRgba8;
+}
+
+[[nodiscard]] const char* get_texture_format_name(TextureFormat format) noexcept {
+  switch(format) {
+  case TextureFormatSrgb8Alpha8: { return "SRGB8_ALPHA8"; }
+  case TextureFormatRgb565: { return "RGB565"; }
+  case TextureFormatRgba4: { return "RGBA4"; }
+  case TextureFormatRg8: { return "RG8"; }
+  case TextureFormatR8: { return "R8"; }
+  default: { return "RGBA8"; }
+  }
+}
+} // namespace fre2d
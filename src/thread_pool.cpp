@@ -0,0 +1,85 @@
+// MIT License
+//
+// Copyright (c) 2025 Ferhat Geçdoğan All Rights Reserved.
+// Distributed under the terms of the MIT License.
+//
+#include <thread_pool.hpp>
+#include <algorithm>
+
+namespace fre2d {
+ThreadPool::ThreadPool(std::size_t thread_count) noexcept
+  : _running_count{0}, _stopping{false} {
+  if(thread_count == 0) {
+    const auto hardware_threads = static_cast<std::size_t>(std::thread::hardware_concurrency());
+    thread_count = std::max<std::size_t>(hardware_threads, 2) - 1;
+  }
+  this->_workers.reserve(thread_count);
+  for(std::size_t i = 0; i < thread_count; ++i) {
+    this->_workers.emplace_back([this] {
+      this->_worker_loop();
+    });
+  }
+}
+
+ThreadPool::~ThreadPool() noexcept {
+  {
+    std::lock_guard lock(this->_mutex);
+    this->_stopping = true;
+  }
+  this->_job_available.notify_all();
+  for(auto& worker: this->_workers) {
+    worker.join();
+  }
+}
+
+void ThreadPool::submit(std::function<void()> job) noexcept {
+  {
+    std::lock_guard lock(this->_mutex);
+    this->_jobs.push_back(std::move(job));
+  }
+  this->_job_available.notify_one();
+}
+
+void ThreadPool::wait_idle() noexcept {
+  std::unique_lock lock(this->_mutex);
+  this->_idle.wait(lock, [this] {
+    return this->_jobs.empty() && this->_running_count == 0;
+  });
+}
+
+[[nodiscard]] std::size_t ThreadPool::get_thread_count() const noexcept {
+  return this->_workers.size();
+}
+
+[[nodiscard]] std::size_t ThreadPool::get_queued_count() const noexcept {
+  std::lock_guard lock(this->_mutex);
+  return this->_jobs.size();
+}
+
+void ThreadPool::_worker_loop() noexcept {
+  while(true) {
+    std::function<void()> job;
+    {
+      std::unique_lock lock(this->_mutex);
+      this->_job_available.wait(lock, [this] {
+        return this->_stopping || !this->_jobs.empty();
+      });
+      // queued jobs are still finished on shutdown.
+      if(this->_jobs.empty()) {
+        return;
+      }
+      job = std::move(this->_jobs.front());
+      this->_jobs.pop_front();
+      ++this->_running_count;
+    }
+    job();
+    {
+      std::lock_guard lock(this->_mutex);
+      --this->_running_count;
+      if(this->_jobs.empty() && this->_running_count == 0) {
+        this->_idle.notify_all();
+      }
+    }
+  }
+}
+} // namespace fre2d
@@ -9,22 +9,19 @@
 
 namespace fre2d {
 // use this to initialize VertexBuffer later.
-VertexBuffer::VertexBuffer() noexcept : _vbo_id{0} {}
+VertexBuffer::VertexBuffer() noexcept {}
 
 // use this to initialize VertexBuffer at the time.
-VertexBuffer::VertexBuffer(const std::vector<Vertex>& vertices) noexcept
-  : _vbo_id{0} {
+VertexBuffer::VertexBuffer(const std::vector<Vertex>& vertices) noexcept {
   this->initialize(vertices);
 }
 
 VertexBuffer::~VertexBuffer() noexcept {
-  if(this->get_vbo_id() != 0) {
-    glDeleteBuffers(1, &this->_vbo_id);
-  }
+  ResourceRegistry::get().destroy(this->_handle);
 }
 
 void VertexBuffer::bind() const noexcept {
-  glBindBuffer(GL_ARRAY_BUFFER, this->_vbo_id);
+  glBindBuffer(GL_ARRAY_BUFFER, this->get_vbo_id());
 }
 
 void VertexBuffer::unbind() const noexcept {
@@ -32,25 +29,31 @@ void VertexBuffer::unbind() const noexcept {
 }
 
 void VertexBuffer::initialize(const std::vector<Vertex> &vertices) noexcept {
-  glGenBuffers(1, &this->_vbo_id);
-  glBindBuffer(GL_ARRAY_BUFFER, this->_vbo_id);
+  GLuint vbo_id { 0 };
+  glGenBuffers(1, &vbo_id);
+  ResourceRegistry::get().assign(this->_handle, vbo_id);
+  glBindBuffer(GL_ARRAY_BUFFER, vbo_id);
   glBufferData(
     GL_ARRAY_BUFFER,
     vertices.size() * sizeof(Vertex),
     vertices.data(),
     GL_STATIC_DRAW
   );
+  GpuMemoryTracker::get().track(GpuMemoryClassVertexBuffer, this->_handle.value, vertices.size() * sizeof(Vertex));
 }
 
 // initialize empty vertex buffer.
 void VertexBuffer::empty_initialize(GLsizei size) noexcept {
-  glGenBuffers(1, &this->_vbo_id);
-  glBindBuffer(GL_ARRAY_BUFFER, this->_vbo_id);
+  GLuint vbo_id { 0 };
+  glGenBuffers(1, &vbo_id);
+  ResourceRegistry::get().assign(this->_handle, vbo_id);
+  glBindBuffer(GL_ARRAY_BUFFER, vbo_id);
   // TODO: support custom usage flags like GL_STATIC_DRAW, GL_DYNAMIC_DRAW
   glBufferData(GL_ARRAY_BUFFER, size, NULL, GL_DYNAMIC_DRAW);
+  GpuMemoryTracker::get().track(GpuMemoryClassVertexBuffer, this->_handle.value, static_cast<std::size_t>(size));
 }
 
-[[nodiscard]] const GLuint &VertexBuffer::get_vbo_id() const noexcept {
-  return this->_vbo_id;
+[[nodiscard]] GLuint VertexBuffer::get_vbo_id() const noexcept {
+  return ResourceRegistry::get().get_name(this->_handle);
 }
 } // namespace fre2d
\ No newline at end of file
@@ -0,0 +1,109 @@
+// MIT License
+//
+// Copyright (c) 2025 Ferhat Geçdoğan All Rights Reserved.
+// Distributed under the terms of the MIT License.
+//
+// fre2d_pack: builds .f2pak asset pack from files. images are decoded here
+// (bottom to top, RGB or RGBA like Texture::load()), so runtime only maps
+// pack and uploads; .f2tc (see fre2d_texc) and font files are stored as is,
+// anything else as raw bytes.
+//
+// usage: fre2d_pack <output.f2pak> [name=]<file>...
+//   name defaults to file path as given; it's the key for AssetPack::find().
+#include <asset_pack.hpp>
+#include <stb_image.h>
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace fre2d;
+
+namespace {
+[[nodiscard]] std::string get_extension(const std::string& path) {
+  const auto dot = path.find_last_of('.');
+  if(dot == std::string::npos || path.find_first_of("/\\", dot) != std::string::npos) {
+    return {};
+  }
+  auto extension = path.substr(dot + 1);
+  std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) {
+    return static_cast<char>(std::tolower(c));
+  });
+  return extension;
+}
+} // anonymous namespace
+
+int main(int argc, char** argv) {
+  if(argc < 3) {
+    std::cerr << "usage: " << argv[0] << " <output.f2pak> [name=]<file>...\n";
+    return 1;
+  }
+
+  stbi_set_flip_vertically_on_load_thread(true);
+  AssetPackWriter writer;
+  std::set<std::string> names;
+  std::size_t source_bytes { 0 };
+  for(int i = 2; i < argc; ++i) {
+    const std::string argument { argv[i] };
+    const auto separator = argument.find('=');
+    const auto path = separator == std::string::npos ? argument : argument.substr(separator + 1);
+    const auto name = separator == std::string::npos ? argument : argument.substr(0, separator);
+    if(!names.insert(name).second) {
+      std::cerr << "fre2d_pack: duplicate name " << name << '\n';
+      return 1;
+    }
+
+    std::ifstream file(path, std::ios::binary);
+    if(!file) {
+      std::cerr << "fre2d_pack: cannot open " << path << '\n';
+      return 1;
+    }
+    const std::vector<std::uint8_t> bytes {
+      std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()
+    };
+    source_bytes += bytes.size();
+
+    const auto extension = get_extension(path);
+    int width { 0 }, height { 0 }, channels { 0 };
+    if(extension == "f2tc") {
+      writer.add(name, AssetTypeCompressed, bytes.data(), bytes.size());
+    } else if(extension == "ttf" || extension == "otf" || extension == "ttc") {
+      writer.add(name, AssetTypeFont, bytes.data(), bytes.size());
+    } else if(stbi_info_from_memory(bytes.data(), static_cast<int>(bytes.size()), &width, &height, &channels)) {
+      const int desired_channels { channels == 3 ? 3 : 4 };
+      auto* pixels = stbi_load_from_memory(
+        bytes.data(), static_cast<int>(bytes.size()), &width, &height, &channels, desired_channels
+      );
+      if(!pixels) {
+        std::cerr << "fre2d_pack: cannot decode " << path << '\n';
+        return 1;
+      }
+      writer.add(
+        name,
+        AssetTypePixels,
+        pixels,
+        static_cast<std::size_t>(width) * height * desired_channels,
+        static_cast<std::uint32_t>(width),
+        static_cast<std::uint32_t>(height),
+        static_cast<std::uint32_t>(desired_channels)
+      );
+      stbi_image_free(pixels);
+    } else {
+      writer.add(name, AssetTypeRaw, bytes.data(), bytes.size());
+    }
+  }
+
+  const auto pack = writer.write();
+  std::ofstream output(argv[1], std::ios::binary);
+  if(!output.write(reinterpret_cast<const char*>(pack.data()), static_cast<std::streamsize>(pack.size()))) {
+    std::cerr << "fre2d_pack: cannot write " << argv[1] << '\n';
+    return 1;
+  }
+  std::cout << argv[1] << ": " << writer.get_entry_count() << " asset(s), " << pack.size()
+            << " bytes (sources: " << source_bytes << " bytes)\n";
+  return 0;
+}
@@ -0,0 +1,353 @@
+// MIT License
+//
+// Copyright (c) 2025 Ferhat Geçdoğan All Rights Reserved.
+// Distributed under the terms of the MIT License.
+//
+// fre2d_render: renders queue of scene descriptions into PNG/QOI images,
+// spread over N threads; each one has its own headless context, Renderer,
+// shaders, fonts and textures, so they never wait for each other on GL.
+// reading pixels back and encoding runs on separate encoder threads.
+//
+// usage: fre2d_render [-j render_threads] [-e encode_threads] [scene_file | -]
+//
+// scene format; one command per line, '#' starts comment:
+//   job <output.png | output.qoi> <width> <height>
+//   clear <r> <g> <b> <a>
+//   rect <x> <y> <width> <height> <r> <g> <b> <a> [texture_path]
+//   circle <x> <y> <width> <height> <r> <g> <b> <a> <thickness>
+//   text <x> <y> <font_path> <font_size> <r> <g> <b> <a> <text till end of line>
+//   end
+// coordinates are in pixels and (0, 0) is center of image, like Camera.
+#include <headless_context.hpp>
+#include <frame_readback.hpp>
+#include <rectangle.hpp>
+#include <circle.hpp>
+#include <label.hpp>
+#include <renderer.hpp>
+#include <qoi.hpp>
+#include <sampler_cache.hpp>
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include <stb_image_write.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+using namespace fre2d;
+using Clock = std::chrono::steady_clock;
+
+enum CommandKind {
+  CommandRect,
+  CommandCircle,
+  CommandText
+};
+
+struct Command {
+  CommandKind kind;
+  glm::vec2 position;
+  glm::vec2 size;
+  glm::vec4 color;
+  GLfloat thickness;
+  std::string path; // texture or font
+  FT_UInt font_size;
+  std::string text;
+};
+
+struct Job {
+  std::string output_path;
+  GLsizei width;
+  GLsizei height;
+  glm::vec4 clear_color;
+  std::vector<Command> commands;
+};
+
+struct Stats {
+  std::mutex mutex;
+  std::vector<double> latencies_ms;
+  std::size_t written { 0 };
+  std::size_t failed { 0 };
+};
+
+bool parse_scene(std::istream& input, std::vector<Job>& jobs) {
+  std::string line;
+  std::size_t line_number { 0 };
+  bool in_job { false };
+  const auto fail = [&line_number](const char* message) {
+    std::cerr << "fre2d_render: line " << line_number << ": " << message << '\n';
+    return false;
+  };
+  while(std::getline(input, line)) {
+    ++line_number;
+    std::istringstream stream(line);
+    std::string keyword;
+    if(!(stream >> keyword) || keyword.front() == '#') {
+      continue;
+    }
+    if(keyword == "job") {
+      if(in_job) {
+        return fail("'job' before 'end' of previous one");
+      }
+      Job job { {}, 0, 0, glm::vec4(0.f, 0.f, 0.f, 0.f), {} };
+      if(!(stream >> job.output_path >> job.width >> job.height) || job.width <= 0 || job.height <= 0) {
+        return fail("expected 'job <output> <width> <height>'");
+      }
+      jobs.push_back(std::move(job));
+      in_job = true;
+      continue;
+    }
+    if(!in_job) {
+      return fail("command outside of job");
+    }
+    auto& job = jobs.back();
+    if(keyword == "end") {
+      in_job = false;
+    } else if(keyword == "clear") {
+      auto& c = job.clear_color;
+      if(!(stream >> c.r >> c.g >> c.b >> c.a)) {
+        return fail("expected 'clear <r> <g> <b> <a>'");
+      }
+    } else if(keyword == "rect" || keyword == "circle") {
+      Command command {};
+      command.kind = keyword == "rect" ? CommandRect : CommandCircle;
+      auto& c = command;
+      if(!(stream >> c.position.x >> c.position.y >> c.size.x >> c.size.y
+                  >> c.color.r >> c.color.g >> c.color.b >> c.color.a)) {
+        return fail("expected '<x> <y> <width> <height> <r> <g> <b> <a>'");
+      }
+      if(c.kind == CommandCircle && !(stream >> c.thickness)) {
+        return fail("expected circle thickness");
+      }
+      if(c.kind == CommandRect) {
+        stream >> c.path; // optional texture
+      }
+      job.commands.push_back(std::move(command));
+    } else if(keyword == "text") {
+      Command command {};
+      command.kind = CommandText;
+      auto& c = command;
+      if(!(stream >> c.position.x >> c.position.y >> c.path >> c.font_size
+                  >> c.color.r >> c.color.g >> c.color.b >> c.color.a)) {
+        return fail("expected 'text <x> <y> <font_path> <font_size> <r> <g> <b> <a> <text>'");
+      }
+      std::getline(stream >> std::ws, c.text);
+      job.commands.push_back(std::move(command));
+    } else {
+      return fail("unknown command");
+    }
+  }
+  if(in_job) {
+    return fail("missing 'end'");
+  }
+  return true;
+}
+
+bool write_image(const std::string& path, const ReadbackFrame& frame) {
+  const bool is_qoi { path.size() >= 4 && path.compare(path.size() - 4, 4, ".qoi") == 0 };
+  if(!is_qoi) {
+    // flipping is enabled once in main(), readback rows are bottom to top.
+    return stbi_write_png(path.c_str(), frame.width, frame.height, 4, frame.pixels.data(), frame.width * 4) != 0;
+  }
+  const auto bytes = encode_qoi(
+    frame.pixels.data(),
+    static_cast<std::uint32_t>(frame.width),
+    static_cast<std::uint32_t>(frame.height),
+    4,
+    true
+  );
+  std::ofstream file(path, std::ios::binary);
+  file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+  return !bytes.empty() && file.good();
+}
+
+void render_worker(const std::vector<Job>& jobs,
+                   std::atomic<std::size_t>& next_job,
+                   const FontManager& font_manager,
+                   ThreadPool& encoders,
+                   Stats& stats) {
+  // declared first, so it is released after every GL object below.
+  HeadlessContext context;
+  if(!context.initialize()) {
+    return; // other workers take remaining jobs.
+  }
+  glEnable(GL_BLEND);
+  glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+  auto renderer = std::make_unique<Renderer>();
+  renderer->attach_framebuffer(std::make_unique<Framebuffer>(
+    detail::renderer::default_width,
+    detail::renderer::default_height,
+    RenderTargetDesc { { ColorRgba8 }, DepthStencilNone }
+  ));
+  renderer->attach_camera(std::make_unique<Camera>());
+  renderer->attach_light_manager(std::make_unique<LightManager>());
+  renderer->get_light_manager()->initialize();
+  renderer->get_light_manager()->get_ambient_light_mutable().set_color(glm::vec4(1.f, 1.f, 1.f, 1.f));
+  const auto& fb = renderer->get_framebuffer();
+
+  // per worker caches; GL objects can't be shared between contexts.
+  const Shader default_shader(detail::shader::default_vertex, detail::shader::default_fragment);
+  const Shader circle_shader(detail::circle::default_vertex, detail::circle::default_fragment);
+  const Shader text_shader(detail::label::default_vertex, detail::label::default_fragment);
+  std::unordered_map<std::string, Texture> textures;
+  std::map<std::pair<std::string, FT_UInt>, std::unique_ptr<Font>> fonts;
+
+  struct PendingJob {
+    const Job* job;
+    Clock::time_point start;
+  };
+  std::mutex pending_mutex;
+  std::unordered_map<std::uint64_t, PendingJob> pending;
+  FrameReadback readback([&](ReadbackFrame& frame) {
+    PendingJob info {};
+    {
+      std::lock_guard lock(pending_mutex);
+      info = pending.at(frame.frame_index);
+      pending.erase(frame.frame_index);
+    }
+    const bool written { write_image(info.job->output_path, frame) };
+    const std::chrono::duration<double, std::milli> latency { Clock::now() - info.start };
+    std::lock_guard lock(stats.mutex);
+    if(written) {
+      ++stats.written;
+      stats.latencies_ms.push_back(latency.count());
+    } else {
+      ++stats.failed;
+      std::cerr << "fre2d_render: could not write " << info.job->output_path << '\n';
+    }
+  }, &encoders);
+
+  for(auto index = next_job++; index < jobs.size(); index = next_job++) {
+    const auto& job = jobs[index];
+    const auto start = Clock::now();
+    renderer->resize(job.width, job.height);
+    fb->call([&] {
+      fb->clear_color(job.clear_color.r, job.clear_color.g, job.clear_color.b, job.clear_color.a);
+      for(const auto& command: job.commands) {
+        if(command.kind == CommandRect) {
+          if(!command.path.empty() && !textures.contains(command.path)) {
+            textures.emplace(command.path, Texture(command.path.c_str()));
+          }
+          Rectangle rect(
+            static_cast<GLsizei>(command.size.x),
+            static_cast<GLsizei>(command.size.y),
+            command.position,
+            command.color,
+            command.path.empty() ? Texture::get_default_texture() : textures.at(command.path)
+          );
+          rect.draw(default_shader, renderer);
+        } else if(command.kind == CommandCircle) {
+          Circle circle(
+            static_cast<GLsizei>(command.size.x),
+            static_cast<GLsizei>(command.size.y),
+            command.position,
+            command.color,
+            command.thickness
+          );
+          circle.draw(circle_shader, renderer);
+        } else {
+          auto& font = fonts[{command.path, command.font_size}];
+          if(!font) {
+            font = std::make_unique<Font>(font_manager, command.path.c_str(), command.font_size);
+          }
+          Label label(*font, command.text.c_str(), command.position, command.color);
+          label.draw(text_shader, renderer);
+        }
+      }
+    });
+
+    {
+      std::lock_guard lock(pending_mutex);
+      pending.emplace(readback.get_captured_count(), PendingJob { &job, start });
+    }
+    // every slot in flight; gpu is behind, so let it catch up.
+    while(!readback.capture(*fb)) {
+      readback.poll();
+      std::this_thread::yield();
+    }
+    readback.poll();
+    // rectangles and labels of this job are gone; delete their buffers.
+    ResourceRegistry::get().end_frame();
+  }
+  readback.flush();
+  // samplers and resources are per thread; delete them while this thread's context is current.
+  SamplerCache::get().clear();
+  ResourceRegistry::get().clear();
+}
+
+int main(int argc, char** argv) {
+  std::size_t render_threads { std::max(std::thread::hardware_concurrency() / 2, 1u) };
+  std::size_t encode_threads { detail::thread_pool::default_thread_count };
+  const char* scene_path { "-" };
+  for(int i = 1; i < argc; ++i) {
+    if((std::strcmp(argv[i], "-j") == 0 || std::strcmp(argv[i], "-e") == 0) && i + 1 < argc) {
+      const auto value = static_cast<std::size_t>(std::max(std::atoi(argv[i + 1]), 1));
+      (argv[i][1] == 'j' ? render_threads : encode_threads) = value;
+      ++i;
+    } else if(argv[i][0] != '-' || std::strcmp(argv[i], "-") == 0) {
+      scene_path = argv[i];
+    } else {
+      std::cerr << "usage: " << argv[0] << " [-j render_threads] [-e encode_threads] [scene_file | -]\n";
+      return 1;
+    }
+  }
+
+  std::vector<Job> jobs;
+  {
+    std::ifstream file;
+    if(std::strcmp(scene_path, "-") != 0) {
+      file.open(scene_path);
+      if(!file) {
+        std::cerr << "fre2d_render: cannot open " << scene_path << '\n';
+        return 1;
+      }
+    }
+    if(!parse_scene(file.is_open() ? static_cast<std::istream&>(file) : std::cin, jobs)) {
+      return 1;
+    }
+  }
+  if(jobs.empty()) {
+    std::cerr << "fre2d_render: no jobs.\n";
+    return 0;
+  }
+  render_threads = std::min(render_threads, jobs.size());
+
+  stbi_flip_vertically_on_write(1); // global in stb; set before any encoder starts.
+  FontManager font_manager; // one FT_Library; Font locks it while creating faces.
+  Stats stats;
+  {
+    ThreadPool encoders(encode_threads);
+    std::atomic<std::size_t> next_job { 0 };
+    const auto start = Clock::now();
+    std::vector<std::thread> workers;
+    for(std::size_t i = 0; i < render_threads; ++i) {
+      workers.emplace_back(render_worker, std::cref(jobs), std::ref(next_job),
+                           std::cref(font_manager), std::ref(encoders), std::ref(stats));
+    }
+    for(auto& worker: workers) {
+      worker.join();
+    }
+    encoders.wait_idle();
+    const std::chrono::duration<double> elapsed { Clock::now() - start };
+
+    auto& latencies = stats.latencies_ms;
+    std::sort(latencies.begin(), latencies.end());
+    const auto percentile = [&latencies](double p) {
+      return latencies.empty() ? 0.0 : latencies[static_cast<std::size_t>(p * (latencies.size() - 1))];
+    };
+    std::cout << "rendered " << stats.written << "/" << jobs.size() << " images ("
+              << stats.failed << " failed) in " << elapsed.count() << " s with "
+              << render_threads << " render and " << encoders.get_thread_count() << " encode threads\n"
+              << "throughput: " << static_cast<double>(stats.written) / elapsed.count() << " images/s\n"
+              << "latency ms: p50 " << percentile(0.5) << ", p95 " << percentile(0.95)
+              << ", max " << percentile(1.0) << '\n';
+  }
+  return stats.written == jobs.size() ? 0 : 1;
+}
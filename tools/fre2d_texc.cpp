@@ -0,0 +1,179 @@
+// MIT License
+//
+// Copyright (c) 2025 Ferhat Geçdoğan All Rights Reserved.
+// Distributed under the terms of the MIT License.
+//
+// fre2d_texc: encodes image into .f2tc (BCn blocks + mip chain) offline, so
+// Texture::load_compressed() uploads it without decoding at runtime.
+// no gpu is needed; block rows are encoded on ThreadPool.
+//
+// usage: fre2d_texc [-f auto|bc1|bc3|bc4|bc7] [-j threads] [--no-mipmap] <input> <output.f2tc>
+//   -f           block format; auto picks BC4 for opaque gray, BC1 for opaque
+//                color and BC7 otherwise.
+//   -j           worker count; 0 (default) uses ThreadPool default.
+//   --no-mipmap  write level 0 only.
+#include <compressed_texture.hpp>
+#include <thread_pool.hpp>
+#include <stb_image.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace fre2d;
+
+namespace {
+// block rows per job; small enough to balance, large enough to amortize submit().
+static constexpr std::uint32_t rows_per_job { 8 };
+
+void print_usage(const char* program) {
+  std::cerr << "usage: " << program
+            << " [-f auto|bc1|bc3|bc4|bc7] [-j threads] [--no-mipmap] <input> <output.f2tc>\n";
+}
+
+[[nodiscard]] BlockFormat pick_block_format(const std::vector<std::uint8_t>& rgba) noexcept {
+  bool gray { true };
+  bool opaque { true };
+  for(std::size_t i = 0; i < rgba.size() && (gray || opaque); i += 4) {
+    gray = gray && rgba[i] == rgba[i + 1] && rgba[i + 1] == rgba[i + 2];
+    opaque = opaque && rgba[i + 3] == 255;
+  }
+  if(opaque) {
+    return gray ? BlockFormatBc4 : BlockFormatBc1;
+  }
+  return BlockFormatBc7;
+}
+
+// 2x2 box filter; odd edge is clamped.
+[[nodiscard]] std::vector<std::uint8_t> downsample(const std::vector<std::uint8_t>& rgba,
+                                                   std::uint32_t width,
+                                                   std::uint32_t height) {
+  const std::uint32_t next_width { std::max(width / 2, 1u) }, next_height { std::max(height / 2, 1u) };
+  std::vector<std::uint8_t> next(static_cast<std::size_t>(next_width) * next_height * 4);
+  for(std::uint32_t y = 0; y < next_height; ++y) {
+    const std::uint32_t y0 { std::min(y * 2, height - 1) }, y1 { std::min(y * 2 + 1, height - 1) };
+    for(std::uint32_t x = 0; x < next_width; ++x) {
+      const std::uint32_t x0 { std::min(x * 2, width - 1) }, x1 { std::min(x * 2 + 1, width - 1) };
+      for(std::uint32_t c = 0; c < 4; ++c) {
+        const auto at = [&](std::uint32_t sx, std::uint32_t sy) -> unsigned {
+          return rgba[(static_cast<std::size_t>(sy) * width + sx) * 4 + c];
+        };
+        next[(static_cast<std::size_t>(y) * next_width + x) * 4 + c] =
+          static_cast<std::uint8_t>((at(x0, y0) + at(x1, y0) + at(x0, y1) + at(x1, y1) + 2) / 4);
+      }
+    }
+  }
+  return next;
+}
+} // anonymous namespace
+
+int main(int argc, char** argv) {
+  std::string format_name { "auto" };
+  std::size_t threads { detail::thread_pool::default_thread_count };
+  bool mipmap { true };
+  std::vector<const char*> paths;
+  for(int i = 1; i < argc; ++i) {
+    if(std::strcmp(argv[i], "-f") == 0 && i + 1 < argc) {
+      format_name = argv[++i];
+    } else if(std::strcmp(argv[i], "-j") == 0 && i + 1 < argc) {
+      threads = static_cast<std::size_t>(std::strtoul(argv[++i], nullptr, 10));
+    } else if(std::strcmp(argv[i], "--no-mipmap") == 0) {
+      mipmap = false;
+    } else if(argv[i][0] == '-') {
+      print_usage(argv[0]);
+      return 1;
+    } else {
+      paths.push_back(argv[i]);
+    }
+  }
+  if(paths.size() != 2) {
+    print_usage(argv[0]);
+    return 1;
+  }
+
+  // same orientation as Texture::load().
+  stbi_set_flip_vertically_on_load_thread(true);
+  int width { 0 }, height { 0 }, channels { 0 };
+  auto* pixels = stbi_load(paths[0], &width, &height, &channels, 4);
+  if(!pixels) {
+    std::cerr << "fre2d_texc: cannot load " << paths[0] << '\n';
+    return 1;
+  }
+  std::vector<std::uint8_t> rgba(pixels, pixels + static_cast<std::size_t>(width) * height * 4);
+  stbi_image_free(pixels);
+
+  BlockFormat format;
+  if(format_name == "auto") {
+    format = pick_block_format(rgba);
+  } else if(format_name == "bc1") {
+    format = BlockFormatBc1;
+  } else if(format_name == "bc3") {
+    format = BlockFormatBc3;
+  } else if(format_name == "bc4") {
+    format = BlockFormatBc4;
+  } else if(format_name == "bc7") {
+    format = BlockFormatBc7;
+  } else {
+    print_usage(argv[0]);
+    return 1;
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  ThreadPool pool(threads);
+  CompressedImage image { format, {} };
+  auto level_width = static_cast<std::uint32_t>(width);
+  auto level_height = static_cast<std::uint32_t>(height);
+  // every level is kept alive till wait_idle(); jobs read them.
+  std::vector<std::vector<std::uint8_t>> sources;
+  sources.push_back(std::move(rgba));
+  while(true) {
+    image.levels.push_back(CompressedLevel{
+      level_width,
+      level_height,
+      std::vector<std::uint8_t>(get_compressed_level_size(format, level_width, level_height))
+    });
+    if(!mipmap || (level_width == 1 && level_height == 1)) {
+      break;
+    }
+    sources.push_back(downsample(sources.back(), level_width, level_height));
+    level_width = std::max(level_width / 2, 1u);
+    level_height = std::max(level_height / 2, 1u);
+  }
+  for(std::size_t level = 0; level < image.levels.size(); ++level) {
+    auto& target = image.levels[level];
+    const std::uint32_t block_rows { (target.height + detail::compressed_texture::block_dimension - 1) /
+                                     detail::compressed_texture::block_dimension };
+    for(std::uint32_t row = 0; row < block_rows; row += rows_per_job) {
+      pool.submit([&, level, row, block_rows] {
+        encode_block_rows(format, sources[level].data(), target.width, target.height,
+                          row, std::min(row + rows_per_job, block_rows), target.blocks.data());
+      });
+    }
+  }
+  pool.wait_idle();
+  const auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+  const auto bytes = write_compressed_texture(image);
+  std::ofstream file(paths[1], std::ios::binary);
+  if(!file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()))) {
+    std::cerr << "fre2d_texc: cannot write " << paths[1] << '\n';
+    return 1;
+  }
+
+  std::size_t rgba8_bytes { 0 };
+  for(const auto& level: image.levels) {
+    rgba8_bytes += static_cast<std::size_t>(level.width) * level.height * 4;
+  }
+  std::cout << paths[0] << " -> " << paths[1] << ": " << width << 'x' << height << ' '
+            << get_block_format_name(format) << ", " << image.levels.size() << " level(s), "
+            << bytes.size() << " bytes (" << std::fixed << std::setprecision(1)
+            << static_cast<double>(rgba8_bytes) / static_cast<double>(bytes.size())
+            << "x smaller than RGBA8), encoded in " << elapsed << " ms on "
+            << pool.get_thread_count() << " thread(s)\n";
+  return 0;
+}
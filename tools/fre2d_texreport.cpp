@@ -0,0 +1,109 @@
+// MIT License
+//
+// Copyright (c) 2025 Ferhat Geçdoğan All Rights Reserved.
+// Distributed under the terms of the MIT License.
+//
+// fre2d_texreport: reports how much texture memory an asset set would take as
+// RGBA8 and with smallest TextureFormat that fits each image; so it's easy
+// to see which files are worth loading as R8/RG8 (or RGB565/RGBA4).
+// no gpu is needed; sizes include full mip chain.
+//
+// usage: fre2d_texreport [--lossy] [--no-mipmap] <image>...
+//   --lossy      also suggest RGB565/RGBA4 for color images.
+//   --no-mipmap  count level 0 only.
+#include <texture_format.hpp>
+#include <stb_image.h>
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace fre2d;
+
+namespace {
+// bytes of width x height image and its mip chain down to 1x1.
+[[nodiscard]] std::size_t storage_bytes(int width, int height, std::size_t bytes_per_pixel, bool mipmap) noexcept {
+  std::size_t total { 0 };
+  while(true) {
+    total += static_cast<std::size_t>(width) * height * bytes_per_pixel;
+    if(!mipmap || (width == 1 && height == 1)) {
+      return total;
+    }
+    width = std::max(width / 2, 1);
+    height = std::max(height / 2, 1);
+  }
+}
+
+[[nodiscard]] std::string format_bytes(std::size_t bytes) {
+  const char* units[] { "B", "KiB", "MiB", "GiB" };
+  auto value = static_cast<double>(bytes);
+  std::size_t unit { 0 };
+  for(; value >= 1024.0 && unit + 1 < std::size(units); ++unit) {
+    value /= 1024.0;
+  }
+  std::ostringstream stream;
+  stream << std::fixed << std::setprecision(unit == 0 ? 0 : 1) << value << ' ' << units[unit];
+  return stream.str();
+}
+} // anonymous namespace
+
+int main(int argc, char** argv) {
+  bool allow_lossy { false };
+  bool mipmap { true };
+  std::vector<const char*> paths;
+  for(int i = 1; i < argc; ++i) {
+    if(std::strcmp(argv[i], "--lossy") == 0) {
+      allow_lossy = true;
+    } else if(std::strcmp(argv[i], "--no-mipmap") == 0) {
+      mipmap = false;
+    } else if(argv[i][0] == '-') {
+      std::cerr << "usage: " << argv[0] << " [--lossy] [--no-mipmap] <image>...\n";
+      return 1;
+    } else {
+      paths.push_back(argv[i]);
+    }
+  }
+  if(paths.empty()) {
+    std::cerr << "usage: " << argv[0] << " [--lossy] [--no-mipmap] <image>...\n";
+    return 1;
+  }
+
+  std::size_t total_rgba8 { 0 }, total_suggested { 0 }, failed { 0 };
+  std::cout << std::left << std::setw(40) << "image" << std::setw(12) << "size"
+            << std::setw(14) << "format" << std::setw(12) << "RGBA8" << "suggested\n";
+  for(const auto* path: paths) {
+    int width { 0 }, height { 0 }, channels { 0 };
+    stbi_info(path, &width, &height, &channels);
+    const int desired_channels { channels == 3 ? 3 : 4 };
+    auto* pixels = stbi_load(path, &width, &height, &channels, desired_channels);
+    if(!pixels) {
+      std::cerr << "fre2d_texreport: cannot load " << path << '\n';
+      ++failed;
+      continue;
+    }
+    const auto format = suggest_texture_format(
+      pixels, desired_channels, static_cast<std::size_t>(width) * height, allow_lossy
+    );
+    stbi_image_free(pixels);
+
+    const auto rgba8 = storage_bytes(width, height, 4, mipmap);
+    const auto suggested = storage_bytes(width, height, get_texture_format_info(format).bytes_per_pixel, mipmap);
+    total_rgba8 += rgba8;
+    total_suggested += suggested;
+    std::cout << std::setw(40) << path
+              << std::setw(12) << (std::to_string(width) + "x" + std::to_string(height))
+              << std::setw(14) << get_texture_format_name(format)
+              << std::setw(12) << format_bytes(rgba8) << format_bytes(suggested) << '\n';
+  }
+
+  const auto saved = total_rgba8 - total_suggested;
+  std::cout << "\ntotal: " << format_bytes(total_rgba8) << " as RGBA8, "
+            << format_bytes(total_suggested) << " with suggested formats; saves "
+            << format_bytes(saved) << " (" << std::fixed << std::setprecision(1)
+            << (total_rgba8 == 0 ? 0.0 : 100.0 * static_cast<double>(saved) / static_cast<double>(total_rgba8))
+            << "%)\n";
+  return failed == 0 ? 0 : 1;
+}